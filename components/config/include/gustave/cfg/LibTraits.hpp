@@ -53,4 +53,8 @@ namespace gustave::cfg {
 
     template<cLibConfig auto cfg, auto unit>
     using Real = decltype(cfg.realTraits)::template Type<unit, typename decltype(cfg)::RealRep>;
+
+    template<cLibConfig auto cfg, cRealRep RealRep>
+        requires cLibConfigWithRealRep<decltype(cfg), RealRep>
+    inline constexpr auto withRealRep = typename decltype(cfg)::template WithRealRep<RealRep>{};
 }
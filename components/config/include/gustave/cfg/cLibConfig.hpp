@@ -41,4 +41,10 @@ namespace gustave::cfg {
         requires std::integral<typename T::NodeIndex>;
         requires std::integral<typename T::StructureIndex>;
     };
+
+    template<typename T, typename RealRep>
+    concept cLibConfigWithRealRep = requires {
+        requires cLibConfig<T>;
+        requires cLibConfig<typename T::template WithRealRep<RealRep>>;
+    };
 }
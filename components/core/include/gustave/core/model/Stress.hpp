@@ -27,6 +27,9 @@
 
 #include <cassert>
 #include <concepts>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
 
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/cfg/cUnitOf.hpp>
@@ -81,6 +84,21 @@ namespace gustave::core::model {
             return libCfg_;
         }
 
+        // Throws std::invalid_argument unless all coordinates are strictly positive.
+        // name: designates this stress in the error message.
+        void checkStrictlyPositive(std::string_view name) const {
+            auto checkCoord = [&](std::string_view coordName, Coord value) {
+                if (value <= 0.f * unit_) {
+                    std::stringstream msg;
+                    msg << name << '.' << coordName << " must be strictly positive (passed: " << value << ").";
+                    throw std::invalid_argument(msg.str());
+                }
+            };
+            checkCoord("compression", compression_);
+            checkCoord("shear", shear_);
+            checkCoord("tensile", tensile_);
+        }
+
         [[nodiscard]]
         Coord maxCoord() const {
             return rt.max(rt.max(compression_, shear_), tensile_);
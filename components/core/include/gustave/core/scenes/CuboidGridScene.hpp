@@ -26,6 +26,8 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <utility>
 
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/cfg/LibTraits.hpp>
@@ -35,14 +37,19 @@
 #include <gustave/core/scenes/cuboidGridScene/detail/SceneUpdater.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/StructureData.hpp>
 #include <gustave/core/scenes/cuboidGridScene/BlockReference.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockRegion.hpp>
 #include <gustave/core/scenes/cuboidGridScene/Blocks.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockView.hpp>
 #include <gustave/core/scenes/cuboidGridScene/ContactReference.hpp>
 #include <gustave/core/scenes/cuboidGridScene/Contacts.hpp>
+#include <gustave/core/scenes/cuboidGridScene/ContactView.hpp>
 #include <gustave/core/scenes/cuboidGridScene/Links.hpp>
 #include <gustave/core/scenes/cuboidGridScene/StructureReference.hpp>
 #include <gustave/core/scenes/cuboidGridScene/Structures.hpp>
+#include <gustave/core/scenes/cuboidGridScene/Terrain.hpp>
 #include <gustave/core/scenes/cuboidGridScene/Transaction.hpp>
 #include <gustave/core/scenes/cuboidGridScene/TransactionResult.hpp>
+#include <gustave/utils/cExecutor.hpp>
 #include <gustave/utils/NoInit.hpp>
 
 namespace gustave::core::scenes {
@@ -70,12 +77,16 @@ namespace gustave::core::scenes {
         template<bool mut>
         using BlockReference = cuboidGridScene::BlockReference<libCfg, UD_, mut>;
 
+        using BlockView = cuboidGridScene::BlockView<libCfg, UD_>;
+
         template<bool mut>
         using Contacts = cuboidGridScene::Contacts<libCfg, UD_, mut>;
 
         template<bool mut>
         using ContactReference = cuboidGridScene::ContactReference<libCfg, UD_, mut>;
 
+        using ContactView = cuboidGridScene::ContactView<libCfg, UD_>;
+
         template<bool mut>
         using Links = cuboidGridScene::Links<libCfg, UD_, mut>;
 
@@ -85,11 +96,13 @@ namespace gustave::core::scenes {
         template<bool mut>
         using StructureReference = cuboidGridScene::StructureReference<libCfg, UD_, mut>;
 
+        using Terrain = cuboidGridScene::Terrain<libCfg>;
         using Transaction = cuboidGridScene::Transaction<libCfg>;
         using TransactionResult = cuboidGridScene::TransactionResult<libCfg>;
         using UserDataMember = UDTraits::CommonMember;
 
         using BlockIndex = BlockReference<false>::BlockIndex;
+        using BlockRegion = cuboidGridScene::BlockRegion;
         using ContactIndex = ContactReference<false>::ContactIndex;
         using Direction = ContactIndex::Direction;
         using StructureIndex = StructureReference<false>::StructureIndex;
@@ -100,6 +113,11 @@ namespace gustave::core::scenes {
             : data_{ blockSize }
         {}
 
+        [[nodiscard]]
+        explicit CuboidGridScene(Vector3<u.length> const& blockSize, Terrain terrain)
+            : data_{ blockSize, std::move(terrain) }
+        {}
+
         CuboidGridScene(CuboidGridScene const&) = delete;
         CuboidGridScene& operator=(CuboidGridScene const&) = delete;
 
@@ -112,6 +130,10 @@ namespace gustave::core::scenes {
             return SceneUpdater{ data_ }.runTransaction(transaction);
         }
 
+        TransactionResult modify(Transaction const& transaction, utils::cExecutor auto& executor) {
+            return SceneUpdater{ data_ }.runTransaction(transaction, executor);
+        }
+
         [[nodiscard]]
         Blocks<true> blocks() {
             return Blocks<true>{ data_ };
@@ -162,6 +184,11 @@ namespace gustave::core::scenes {
             return Structures<false>{ data_ };
         }
 
+        [[nodiscard]]
+        std::optional<Terrain> const& terrain() const {
+            return data_.terrain();
+        }
+
         [[nodiscard]]
         Real<u.length> thicknessAlong(Direction direction) const {
             return data_.thicknessAlong(direction);
@@ -33,6 +33,7 @@
 #include <gustave/cfg/LibTraits.hpp>
 #include <gustave/core/model/Stress.hpp>
 #include <gustave/core/scenes/cuboidGridScene/BlockIndex.hpp>
+#include <gustave/core/scenes/cuboidGridScene/MaterialIndex.hpp>
 
 namespace gustave::core::scenes::cuboidGridScene {
     template<cfg::cLibConfig auto libCfg>
@@ -44,25 +45,19 @@ namespace gustave::core::scenes::cuboidGridScene {
         using Real = cfg::Real<libCfg, unit>;
     public:
         using BlockIndex = cuboidGridScene::BlockIndex;
+        using MaterialIndex = cuboidGridScene::MaterialIndex;
         using PressureStress = model::PressureStress<libCfg>;
 
         [[nodiscard]]
-        BlockConstructionInfo(BlockIndex const& index, PressureStress const& maxPressureStress, Real<u.mass> mass, bool isFoundation)
+        BlockConstructionInfo(BlockIndex const& index, PressureStress const& maxPressureStress, Real<u.mass> mass, bool isFoundation, MaterialIndex materialId = 0)
             : index_{ index }
             , maxPressureStress_{ maxPressureStress }
             , mass_{ mass }
+            , materialId_{ materialId }
             , isFoundation_{ isFoundation }
         {
             checkMass(mass);
-            if (maxPressureStress_.compression() <= 0.f * u.pressure) {
-                throw invalidMaxStressError("compression", maxPressureStress_.compression());
-            }
-            if (maxPressureStress_.shear() <= 0.f * u.pressure) {
-                throw invalidMaxStressError("shear", maxPressureStress_.shear());
-            }
-            if (maxPressureStress_.tensile() <= 0.f * u.pressure) {
-                throw invalidMaxStressError("tensile", maxPressureStress_.tensile());
-            }
+            maxPressureStress_.checkStrictlyPositive("maxPressureStress");
         }
 
         [[nodiscard]]
@@ -75,6 +70,11 @@ namespace gustave::core::scenes::cuboidGridScene {
             return index_;
         }
 
+        [[nodiscard]]
+        MaterialIndex materialId() const {
+            return materialId_;
+        }
+
         [[nodiscard]]
         PressureStress const& maxPressureStress() const {
             return maxPressureStress_;
@@ -106,15 +106,9 @@ namespace gustave::core::scenes::cuboidGridScene {
         BlockIndex index_;
         PressureStress maxPressureStress_;
         Real<u.mass> mass_;
+        MaterialIndex materialId_;
         bool isFoundation_;
 
-        [[nodiscard]]
-        static std::invalid_argument invalidMaxStressError(std::string name, Real<u.pressure> value) {
-            std::stringstream result;
-            result << "maxPressureStress." << name << " must be strictly positive (passed: " << value << ").";
-            return std::invalid_argument(result.str());
-        }
-
         void checkMass(Real<u.mass> value) {
             if (value <= 0.f * u.mass) {
                 std::stringstream msg;
@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <limits>
@@ -32,7 +33,6 @@
 #include <ostream>
 
 #include <gustave/math3d/BasicDirection.hpp>
-#include <gustave/utils/Hasher.hpp>
 #include <gustave/utils/NoInit.hpp>
 
 namespace gustave::core::scenes::cuboidGridScene {
@@ -107,7 +107,18 @@ namespace gustave::core::scenes::cuboidGridScene {
         Coord y;
         Coord z;
 
-        using Hasher = utils::Hasher<BlockIndex, &BlockIndex::x, &BlockIndex::y, &BlockIndex::z>;
+        // Multiply-add chain over the three coordinates. The final fold brings the well-mixed high bits
+        // into the low bits (used by power-of-two tables like utils::FlatHashMap).
+        struct Hasher {
+        public:
+            [[nodiscard]]
+            std::size_t operator()(BlockIndex const& index) const {
+                std::uint64_t result = static_cast<std::uint64_t>(index.x) * 0x9E3779B97F4A7C15;
+                result = (result + static_cast<std::uint64_t>(index.y)) * 0xC2B2AE3D27D4EB4F;
+                result = (result + static_cast<std::uint64_t>(index.z)) * 0x165667B19E3779F9;
+                return static_cast<std::size_t>(result ^ (result >> 29));
+            }
+        };
     };
 }
 
@@ -39,8 +39,10 @@
 #include <gustave/core/scenes/cuboidGridScene/detail/DataNeighbours.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/SceneData.hpp>
 #include <gustave/core/scenes/cuboidGridScene/BlockIndex.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockView.hpp>
 #include <gustave/core/scenes/cuboidGridScene/ContactReference.hpp>
 #include <gustave/core/scenes/cuboidGridScene/forwardDecls.hpp>
+#include <gustave/core/scenes/cuboidGridScene/MaterialIndex.hpp>
 #include <gustave/core/scenes/cuboidGridScene/StructureReference.hpp>
 #include <gustave/math3d/BasicDirection.hpp>
 #include <gustave/meta/Meta.hpp>
@@ -77,8 +79,10 @@ namespace gustave::core::scenes::cuboidGridScene {
         using Vector3 = cfg::Vector3<libCfg, unit>;
     public:
         using BlockIndex = cuboidGridScene::BlockIndex;
+        using BlockView = cuboidGridScene::BlockView<libCfg, UD_>;
         using CommonUserDataMember = UDTraits::CommonMember;
         using Direction = math3d::BasicDirection;
+        using MaterialIndex = cuboidGridScene::MaterialIndex;
         using PressureStress = model::PressureStress<libCfg>;
         using UserDataMember = UDTraits::BlockMember;
 
@@ -210,6 +214,11 @@ namespace gustave::core::scenes::cuboidGridScene {
             return data().mass();
         }
 
+        [[nodiscard]]
+        MaterialIndex materialId() const {
+            return data().materialId();
+        }
+
         [[nodiscard]]
         PressureStress const& maxPressureStress() const {
             return data().maxPressureStress();
@@ -254,6 +263,11 @@ namespace gustave::core::scenes::cuboidGridScene {
             return data().userData();
         }
 
+        [[nodiscard]]
+        BlockView view() const {
+            return BlockView{ data() };
+        }
+
         [[nodiscard]]
         bool operator==(BlockReference const&) const = default;
     private:
@@ -0,0 +1,120 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+
+#include <gustave/core/scenes/cuboidGridScene/BlockIndex.hpp>
+
+namespace gustave::core::scenes::cuboidGridScene {
+    // Axis-aligned box of block indices, bounds included.
+    class BlockRegion {
+    public:
+        using Coord = BlockIndex::Coord;
+
+        [[nodiscard]]
+        BlockRegion(BlockIndex const& minIndex, BlockIndex const& maxIndex)
+            : minIndex_{ minIndex }
+            , maxIndex_{ maxIndex }
+        {
+            if (minIndex.x > maxIndex.x || minIndex.y > maxIndex.y || minIndex.z > maxIndex.z) {
+                std::stringstream msg;
+                msg << "Invalid region: minIndex " << minIndex << " is greater than maxIndex " << maxIndex << " along an axis.";
+                throw std::invalid_argument(msg.str());
+            }
+        }
+
+        [[nodiscard]]
+        bool contains(BlockIndex const& index) const {
+            return index.x >= minIndex_.x && index.x <= maxIndex_.x
+                && index.y >= minIndex_.y && index.y <= maxIndex_.y
+                && index.z >= minIndex_.z && index.z <= maxIndex_.z;
+        }
+
+        // Position of index in the x-major order used to iterate the region (and to store voxel data).
+        [[nodiscard]]
+        std::size_t localIdOf(BlockIndex const& index) const {
+            assert(contains(index));
+            return (std::size_t(index.z - minIndex_.z) * sizeY() + std::size_t(index.y - minIndex_.y)) * sizeX() + std::size_t(index.x - minIndex_.x);
+        }
+
+        [[nodiscard]]
+        std::optional<BlockRegion> intersection(BlockRegion const& other) const {
+            BlockIndex const minIndex{ std::max(minIndex_.x, other.minIndex_.x), std::max(minIndex_.y, other.minIndex_.y), std::max(minIndex_.z, other.minIndex_.z) };
+            BlockIndex const maxIndex{ std::min(maxIndex_.x, other.maxIndex_.x), std::min(maxIndex_.y, other.maxIndex_.y), std::min(maxIndex_.z, other.maxIndex_.z) };
+            if (minIndex.x > maxIndex.x || minIndex.y > maxIndex.y || minIndex.z > maxIndex.z) {
+                return {};
+            }
+            return BlockRegion{ minIndex, maxIndex };
+        }
+
+        [[nodiscard]]
+        BlockIndex const& maxIndex() const {
+            return maxIndex_;
+        }
+
+        [[nodiscard]]
+        BlockIndex const& minIndex() const {
+            return minIndex_;
+        }
+
+        [[nodiscard]]
+        std::size_t sizeX() const {
+            return std::size_t(maxIndex_.x - minIndex_.x) + 1;
+        }
+
+        [[nodiscard]]
+        std::size_t sizeY() const {
+            return std::size_t(maxIndex_.y - minIndex_.y) + 1;
+        }
+
+        [[nodiscard]]
+        std::size_t sizeZ() const {
+            return std::size_t(maxIndex_.z - minIndex_.z) + 1;
+        }
+
+        [[nodiscard]]
+        std::size_t volume() const {
+            return sizeX() * sizeY() * sizeZ();
+        }
+
+        [[nodiscard]]
+        bool operator==(BlockRegion const&) const = default;
+
+        friend std::ostream& operator<<(std::ostream& stream, BlockRegion const& region) {
+            return stream << "{ \"minIndex\": " << region.minIndex_ << ", \"maxIndex\": " << region.maxIndex_ << " }";
+        }
+    private:
+        BlockIndex minIndex_;
+        BlockIndex maxIndex_;
+    };
+}
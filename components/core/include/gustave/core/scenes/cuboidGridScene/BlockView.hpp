@@ -0,0 +1,124 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/model/Stress.hpp>
+#include <gustave/core/scenes/common/cSceneUserData.hpp>
+#include <gustave/core/scenes/common/UserDataTraits.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/SceneData.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockIndex.hpp>
+#include <gustave/core/scenes/cuboidGridScene/MaterialIndex.hpp>
+
+namespace gustave::core::scenes::cuboidGridScene {
+    // Non-owning, read-only view of a block. Unlike BlockReference, it does not extend the lifetime of the
+    // block: it is only valid until the next transaction of the scene.
+    template<cfg::cLibConfig auto libCfg, common::cSceneUserData UD_>
+    class BlockView {
+    private:
+        static constexpr auto u = cfg::units(libCfg);
+
+        using SceneData = detail::SceneData<libCfg, UD_>;
+
+        using BlockData = SceneData::BlockData;
+        using UDTraits = common::UserDataTraits<UD_>;
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Vector3 = cfg::Vector3<libCfg, unit>;
+    public:
+        using BlockIndex = cuboidGridScene::BlockIndex;
+        using CommonUserDataMember = UDTraits::CommonMember;
+        using MaterialIndex = cuboidGridScene::MaterialIndex;
+        using PressureStress = model::PressureStress<libCfg>;
+        using UserDataMember = UDTraits::BlockMember;
+
+        [[nodiscard]]
+        explicit BlockView(BlockData const& data)
+            : data_{ &data }
+        {}
+
+        [[nodiscard]]
+        Vector3<u.length> const& blockSize() const {
+            return data_->sceneData().blockSize();
+        }
+
+        [[nodiscard]]
+        CommonUserDataMember const& commonUserData() const
+            requires (UDTraits::hasCommonUserData())
+        {
+            return data_->sceneData().userData();
+        }
+
+        [[nodiscard]]
+        BlockIndex const& index() const {
+            return data_->index();
+        }
+
+        [[nodiscard]]
+        bool isFoundation() const {
+            return data_->isFoundation();
+        }
+
+        [[nodiscard]]
+        Real<u.mass> mass() const {
+            return data_->mass();
+        }
+
+        [[nodiscard]]
+        MaterialIndex materialId() const {
+            return data_->materialId();
+        }
+
+        [[nodiscard]]
+        PressureStress const& maxPressureStress() const {
+            return data_->maxPressureStress();
+        }
+
+        [[nodiscard]]
+        Vector3<u.length> position() const {
+            using Rep = Real<u.length>::Rep;
+            auto const& bSize = blockSize();
+            BlockIndex const& id = index();
+            return Vector3<u.length>{ Rep(id.x) * bSize.x(), Rep(id.y) * bSize.y(), Rep(id.z) * bSize.z() };
+        }
+
+        [[nodiscard]]
+        UserDataMember const& userData() const
+            requires (UDTraits::hasBlockUserData())
+        {
+            return data_->userData();
+        }
+
+        [[nodiscard]]
+        bool operator==(BlockView const&) const = default;
+    private:
+        BlockData const* data_;
+    };
+}
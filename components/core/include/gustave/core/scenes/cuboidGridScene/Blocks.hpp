@@ -25,10 +25,13 @@
 
 #pragma once
 
+#include <vector>
+
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/core/scenes/common/cSceneUserData.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/SceneData.hpp>
 #include <gustave/core/scenes/cuboidGridScene/BlockReference.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockRegion.hpp>
 #include <gustave/meta/Meta.hpp>
 #include <gustave/utils/ForwardIterator.hpp>
 #include <gustave/utils/NoInit.hpp>
@@ -152,6 +155,19 @@ namespace gustave::core::scenes::cuboidGridScene {
             return BlockReference<false>{ *sceneData_, index };
         }
 
+        // Blocks inside region, in unspecified order.
+        [[nodiscard]]
+        std::vector<BlockReference<true>> inRegion(BlockRegion const& region)
+            requires (isMut_)
+        {
+            return doInRegion(*this, region);
+        }
+
+        [[nodiscard]]
+        std::vector<BlockReference<false>> inRegion(BlockRegion const& region) const {
+            return doInRegion(*this, region);
+        }
+
         [[nodiscard]]
         std::size_t size() const {
             return sceneData_->blocks.size();
@@ -169,6 +185,16 @@ namespace gustave::core::scenes::cuboidGridScene {
             return result;
         }
 
+        [[nodiscard]]
+        static auto doInRegion(meta::cCvRefOf<Blocks> auto&& self, BlockRegion const& region) {
+            using Result = decltype(self.inRegion(region));
+            Result result;
+            self.sceneData_->blockChunks.forEachIn(region, [&](auto const& block) {
+                result.emplace_back(*self.sceneData_, block.index());
+            });
+            return result;
+        }
+
         PropPtr<SceneData> sceneData_;
     };
 }
@@ -38,6 +38,7 @@
 #include <gustave/core/scenes/cuboidGridScene/detail/SceneData.hpp>
 #include <gustave/core/scenes/cuboidGridScene/BlockReference.hpp>
 #include <gustave/core/scenes/cuboidGridScene/ContactIndex.hpp>
+#include <gustave/core/scenes/cuboidGridScene/ContactView.hpp>
 #include <gustave/core/scenes/cuboidGridScene/forwardDecls.hpp>
 #include <gustave/core/scenes/cuboidGridScene/StructureReference.hpp>
 #include <gustave/utils/Prop.hpp>
@@ -76,6 +77,7 @@ namespace gustave::core::scenes::cuboidGridScene {
         using BlockIndex = cuboidGridScene::BlockIndex;
         using CommonUserDataMember = UDTraits::CommonMember;
         using ContactIndex = cuboidGridScene::ContactIndex;
+        using ContactView = cuboidGridScene::ContactView<libCfg, UD_>;
         using Direction = ContactIndex::Direction;
         using PressureStress = model::PressureStress<libCfg>;
         using NormalizedVector3 = cfg::NormalizedVector3<libCfg>;
@@ -105,6 +107,13 @@ namespace gustave::core::scenes::cuboidGridScene {
             if (!localBlock_) {
                 return;
             }
+            if (!localBlock_->hasNeighbourAlong(index.direction())) {
+                auto const otherBlockId = index.otherBlockIndex();
+                if (otherBlockId && !localBlock_->isFoundation() && scene.isGround(*otherBlockId)) {
+                    structure_ = scene.structures.atShared(localBlock_->structureId());
+                }
+                return;
+            }
             if (auto const otherBlockId = index.otherBlockIndex()) {
                 otherBlock_ = scene.blocks.find(*otherBlockId);
                 if (!otherBlock_) {
@@ -195,6 +204,16 @@ namespace gustave::core::scenes::cuboidGridScene {
             return std::out_of_range(msg.str());
         }
 
+        // Contact between the local block and the terrain. otherBlock() and opposite() then refer to the
+        // terrain cell, which holds no block: they are invalid.
+        [[nodiscard]]
+        bool isGroundContact() const {
+            if (!isValid()) {
+                throw invalidError();
+            }
+            return otherBlock_ == nullptr;
+        }
+
         [[nodiscard]]
         bool isValid() const {
             return structure_ && structure_->isValid();
@@ -214,10 +233,7 @@ namespace gustave::core::scenes::cuboidGridScene {
 
         [[nodiscard]]
         PressureStress maxPressureStress() const {
-            if (!isValid()) {
-                throw invalidError();
-            }
-            return PressureStress::minStress(localBlock_->maxPressureStress(), otherBlock_->maxPressureStress());
+            return view().maxPressureStress();
         }
 
         [[nodiscard]]
@@ -254,24 +270,7 @@ namespace gustave::core::scenes::cuboidGridScene {
 
         [[nodiscard]]
         SolverContactIndex solverIndex() const {
-            if (!isValid()) {
-                throw invalidError();
-            }
-            switch (index_.direction().id()) {
-            case Direction::Id::plusX:
-                return SolverContactIndex{ localBlock_->linkIndices().plusX, true};
-            case Direction::Id::minusX:
-                return SolverContactIndex{ otherBlock_->linkIndices().plusX, false};
-            case Direction::Id::plusY:
-                return SolverContactIndex{ localBlock_->linkIndices().plusY, true};
-            case Direction::Id::minusY:
-                return SolverContactIndex{ otherBlock_->linkIndices().plusY, false};
-            case Direction::Id::plusZ:
-                return SolverContactIndex{ localBlock_->linkIndices().plusZ, true};
-            case Direction::Id::minusZ:
-                return SolverContactIndex{ otherBlock_->linkIndices().plusZ, false};
-            }
-            throw index_.direction().invalidError();
+            return view().solverIndex();
         }
 
         [[nodiscard]]
@@ -299,6 +298,17 @@ namespace gustave::core::scenes::cuboidGridScene {
             return structure_->sceneData().thicknessAlong(index_.direction());
         }
 
+        [[nodiscard]]
+        ContactView view() const {
+            if (!isValid()) {
+                throw invalidError();
+            }
+            if (otherBlock_ == nullptr) {
+                return ContactView{ *structure_, *localBlock_, index_ };
+            }
+            return ContactView{ *structure_, *localBlock_, *otherBlock_, index_ };
+        }
+
         template<bool mut>
         [[nodiscard]]
         bool operator==(ContactReference<libCfg, UD_, mut> const& rhs) const {
@@ -337,7 +347,7 @@ namespace gustave::core::scenes::cuboidGridScene {
             if (!self.isValid()) {
                 throw self.invalidError();
             }
-            return Result{ self.structure_->sceneData(), self.otherBlock_->index() };
+            return Result{ self.structure_->sceneData(), *self.index_.otherBlockIndex() };
         }
 
         [[nodiscard]]
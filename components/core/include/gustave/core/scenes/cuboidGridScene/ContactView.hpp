@@ -0,0 +1,178 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <sstream>
+#include <stdexcept>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/model/Stress.hpp>
+#include <gustave/core/scenes/common/cSceneUserData.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/SceneData.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockView.hpp>
+#include <gustave/core/scenes/cuboidGridScene/ContactIndex.hpp>
+#include <gustave/core/solvers/Structure.hpp>
+
+namespace gustave::core::scenes::cuboidGridScene {
+    // Non-owning, read-only view of a valid contact. Unlike ContactReference, it does not extend the lifetime
+    // of its structure: it is only valid until the next transaction of the scene.
+    // A ground contact is between a block and the terrain: it has no other block, nor opposite contact.
+    template<cfg::cLibConfig auto libCfg, common::cSceneUserData UD_>
+    class ContactView {
+    private:
+        static constexpr auto u = cfg::units(libCfg);
+
+        using SceneData = detail::SceneData<libCfg, UD_>;
+
+        using BlockData = SceneData::BlockData;
+        using StructureData = SceneData::StructureData;
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
+    public:
+        using BlockView = cuboidGridScene::BlockView<libCfg, UD_>;
+        using ContactIndex = cuboidGridScene::ContactIndex;
+        using Direction = ContactIndex::Direction;
+        using NormalizedVector3 = cfg::NormalizedVector3<libCfg>;
+        using PressureStress = model::PressureStress<libCfg>;
+        using SolverContactIndex = solvers::Structure<libCfg>::ContactIndex;
+        using StructureIndex = SceneData::StructureIndex;
+
+        [[nodiscard]]
+        explicit ContactView(StructureData const& structure, BlockData const& localBlock, BlockData const& otherBlock, ContactIndex const& index)
+            : structure_{ &structure }
+            , localBlock_{ &localBlock }
+            , otherBlock_{ &otherBlock }
+            , index_{ index }
+        {}
+
+        // Ground contact.
+        [[nodiscard]]
+        explicit ContactView(StructureData const& structure, BlockData const& localBlock, ContactIndex const& index)
+            : structure_{ &structure }
+            , localBlock_{ &localBlock }
+            , otherBlock_{ nullptr }
+            , index_{ index }
+        {}
+
+        [[nodiscard]]
+        Real<u.area> area() const {
+            return structure_->sceneData().contactAreaAlong(index_.direction());
+        }
+
+        [[nodiscard]]
+        ContactIndex const& index() const {
+            return index_;
+        }
+
+        [[nodiscard]]
+        bool isGroundContact() const {
+            return otherBlock_ == nullptr;
+        }
+
+        [[nodiscard]]
+        BlockView localBlock() const {
+            return BlockView{ *localBlock_ };
+        }
+
+        [[nodiscard]]
+        PressureStress maxPressureStress() const {
+            if (isGroundContact()) {
+                return PressureStress::minStress(localBlock_->maxPressureStress(), structure_->sceneData().terrain()->maxPressureStress());
+            }
+            return PressureStress::minStress(localBlock_->maxPressureStress(), otherBlock_->maxPressureStress());
+        }
+
+        [[nodiscard]]
+        NormalizedVector3 normal() const {
+            return NormalizedVector3::basisVector(index_.direction());
+        }
+
+        [[nodiscard]]
+        ContactView opposite() const {
+            if (isGroundContact()) {
+                throw groundContactError();
+            }
+            return ContactView{ *structure_, *otherBlock_, *localBlock_, *index_.opposite() };
+        }
+
+        [[nodiscard]]
+        BlockView otherBlock() const {
+            if (isGroundContact()) {
+                throw groundContactError();
+            }
+            return BlockView{ *otherBlock_ };
+        }
+
+        [[nodiscard]]
+        SolverContactIndex solverIndex() const {
+            if (isGroundContact()) {
+                return SolverContactIndex{ *structure_->groundLinkIndexOf(*localBlock_, index_.direction()), true };
+            }
+            switch (index_.direction().id()) {
+            case Direction::Id::plusX:
+                return SolverContactIndex{ localBlock_->linkIndices().plusX, true };
+            case Direction::Id::minusX:
+                return SolverContactIndex{ otherBlock_->linkIndices().plusX, false };
+            case Direction::Id::plusY:
+                return SolverContactIndex{ localBlock_->linkIndices().plusY, true };
+            case Direction::Id::minusY:
+                return SolverContactIndex{ otherBlock_->linkIndices().plusY, false };
+            case Direction::Id::plusZ:
+                return SolverContactIndex{ localBlock_->linkIndices().plusZ, true };
+            case Direction::Id::minusZ:
+                return SolverContactIndex{ otherBlock_->linkIndices().plusZ, false };
+            }
+            throw index_.direction().invalidError();
+        }
+
+        [[nodiscard]]
+        StructureIndex structureIndex() const {
+            return structure_->index();
+        }
+
+        [[nodiscard]]
+        Real<u.length> thickness() const {
+            return structure_->sceneData().thicknessAlong(index_.direction());
+        }
+
+        [[nodiscard]]
+        bool operator==(ContactView const&) const = default;
+    private:
+        [[nodiscard]]
+        std::logic_error groundContactError() const {
+            std::stringstream msg;
+            msg << "Contact at index " << index_ << " is a ground contact: it has no other block.";
+            return std::logic_error(msg.str());
+        }
+
+        StructureData const* structure_;
+        BlockData const* localBlock_;
+        BlockData const* otherBlock_;
+        ContactIndex index_;
+    };
+}
@@ -27,6 +27,7 @@
 
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/core/scenes/common/cSceneUserData.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/GroundLinks.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/InternalLinks.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/SceneData.hpp>
 #include <gustave/core/scenes/cuboidGridScene/ContactReference.hpp>
@@ -42,6 +43,7 @@ namespace gustave::core::scenes::cuboidGridScene {
             template<typename T>
             using Prop = utils::Prop<isMut_, T>;
 
+            using GroundLinks = cuboidGridScene::detail::GroundLinks<libCfg, UD_>;
             using InternalLinks = cuboidGridScene::detail::InternalLinks<libCfg, UD_>;
             using SceneData = cuboidGridScene::detail::SceneData<libCfg, UD_>;
 
@@ -53,6 +55,7 @@ namespace gustave::core::scenes::cuboidGridScene {
             Enumerator()
                 : blockIt_{}
                 , blockLinks_{ utils::NO_INIT }
+                , groundLinks_{ utils::NO_INIT }
                 , internalLinkId_{ 0 }
             {}
 
@@ -61,10 +64,11 @@ namespace gustave::core::scenes::cuboidGridScene {
                 : scene_{ &scene }
                 , blockIt_{ scene.blocks.begin() }
                 , blockLinks_{ utils::NO_INIT }
+                , groundLinks_{ utils::NO_INIT }
                 , internalLinkId_{ 0 }
             {
                 if (blockIt_ != scene_->blocks.end()) {
-                    blockLinks_ = InternalLinks{ *scene_, (*blockIt_)->index() };
+                    updateBlockLinks();
                     next();
                 }
             }
@@ -77,7 +81,10 @@ namespace gustave::core::scenes::cuboidGridScene {
             [[nodiscard]]
             Value operator*() const {
                 assert(not isEnd());
-                auto const contactId = ContactIndex{ (*blockIt_)->index(), blockLinks_[internalLinkId_].direction() };
+                auto const direction = (internalLinkId_ < blockLinks_.size())
+                    ? blockLinks_[internalLinkId_].direction()
+                    : groundLinks_[internalLinkId_ - blockLinks_.size()];
+                auto const contactId = ContactIndex{ (*blockIt_)->index(), direction };
                 return Value{ *scene_, contactId };
             }
 
@@ -92,12 +99,12 @@ namespace gustave::core::scenes::cuboidGridScene {
             }
         private:
             void next() {
-                if (internalLinkId_ >= blockLinks_.size()) {
+                if (internalLinkId_ >= blockLinks_.size() + groundLinks_.size()) {
                     ++blockIt_;
                     internalLinkId_ = 0;
                     while (blockIt_ != scene_->blocks.end()) {
-                        blockLinks_ = InternalLinks{ *scene_, (*blockIt_)->index() };
-                        if (blockLinks_.size() > 0) {
+                        updateBlockLinks();
+                        if (blockLinks_.size() + groundLinks_.size() > 0) {
                             return;
                         }
                         ++blockIt_;
@@ -105,9 +112,15 @@ namespace gustave::core::scenes::cuboidGridScene {
                 }
             }
 
+            void updateBlockLinks() {
+                blockLinks_ = InternalLinks{ *scene_, (*blockIt_)->index() };
+                groundLinks_ = GroundLinks{ *scene_, blockLinks_.source() };
+            }
+
             Prop<SceneData>* scene_;
             BlockDataIterator blockIt_;
             InternalLinks blockLinks_;
+            GroundLinks groundLinks_;
             std::size_t internalLinkId_;
         };
     }
@@ -0,0 +1,84 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <sstream>
+#include <stdexcept>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/model/Stress.hpp>
+#include <gustave/core/scenes/cuboidGridScene/MaterialIndex.hpp>
+
+namespace gustave::core::scenes::cuboidGridScene {
+    // Edits every block whose material id equals materialId(): its stress becomes newMaxPressureStress(),
+    // and its mass is multiplied by massFactor() (density change).
+    template<cfg::cLibConfig auto libCfg>
+    class MaterialChange {
+    private:
+        static constexpr auto u = cfg::units(libCfg);
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
+    public:
+        using MaterialIndex = cuboidGridScene::MaterialIndex;
+        using PressureStress = model::PressureStress<libCfg>;
+
+        [[nodiscard]]
+        explicit MaterialChange(MaterialIndex materialId, PressureStress const& newMaxPressureStress, Real<u.one> massFactor = 1.f * u.one)
+            : materialId_{ materialId }
+            , newMaxPressureStress_{ newMaxPressureStress }
+            , massFactor_{ massFactor }
+        {
+            newMaxPressureStress_.checkStrictlyPositive("newMaxPressureStress");
+            if (massFactor_ <= 0.f * u.one) {
+                std::stringstream msg;
+                msg << "Expected a strictly positive mass factor (passed: " << massFactor_ << ").";
+                throw std::invalid_argument(msg.str());
+            }
+        }
+
+        [[nodiscard]]
+        Real<u.one> massFactor() const {
+            return massFactor_;
+        }
+
+        [[nodiscard]]
+        MaterialIndex materialId() const {
+            return materialId_;
+        }
+
+        [[nodiscard]]
+        PressureStress const& newMaxPressureStress() const {
+            return newMaxPressureStress_;
+        }
+    private:
+        MaterialIndex materialId_;
+        PressureStress newMaxPressureStress_;
+        Real<u.one> massFactor_;
+    };
+}
@@ -0,0 +1,141 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/model/Stress.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockConstructionInfo.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockIndex.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockRegion.hpp>
+
+namespace gustave::core::scenes::cuboidGridScene {
+    // Blocks of a single type filling a region, either entirely or following a dense occupancy array.
+    template<cfg::cLibConfig auto libCfg>
+    class RegionFill {
+    private:
+        static constexpr auto u = cfg::units(libCfg);
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
+    public:
+        using BlockConstructionInfo = cuboidGridScene::BlockConstructionInfo<libCfg>;
+        using MaterialIndex = BlockConstructionInfo::MaterialIndex;
+        using PressureStress = model::PressureStress<libCfg>;
+
+        [[nodiscard]]
+        explicit RegionFill(BlockRegion const& region, PressureStress const& maxPressureStress, Real<u.mass> mass, bool isFoundation, MaterialIndex materialId = 0)
+            : region_{ region }
+            , prototype_{ region.minIndex(), maxPressureStress, mass, isFoundation, materialId }
+            , blockCount_{ region.volume() }
+        {}
+
+        // occupancy[region.localIdOf(index)] tells if the block at index is filled.
+        [[nodiscard]]
+        explicit RegionFill(BlockRegion const& region, std::vector<bool> occupancy, PressureStress const& maxPressureStress, Real<u.mass> mass, bool isFoundation,
+            MaterialIndex materialId = 0)
+            : region_{ region }
+            , prototype_{ region.minIndex(), maxPressureStress, mass, isFoundation, materialId }
+            , occupancy_{ std::move(occupancy) }
+            , blockCount_{ 0 }
+        {
+            if (occupancy_.size() != region_.volume()) {
+                std::stringstream msg;
+                msg << "Expected an occupancy array of size " << region_.volume() << " (region volume), got " << occupancy_.size() << '.';
+                throw std::invalid_argument(msg.str());
+            }
+            for (bool isOccupied : occupancy_) {
+                if (isOccupied) {
+                    ++blockCount_;
+                }
+            }
+        }
+
+        [[nodiscard]]
+        BlockConstructionInfo blockAt(BlockIndex const& index) const {
+            auto result = prototype_;
+            result.index() = index;
+            return result;
+        }
+
+        [[nodiscard]]
+        std::size_t blockCount() const {
+            return blockCount_;
+        }
+
+        [[nodiscard]]
+        bool isFull() const {
+            return occupancy_.empty();
+        }
+
+        [[nodiscard]]
+        bool isFoundation() const {
+            return prototype_.isFoundation();
+        }
+
+        [[nodiscard]]
+        bool isOccupied(BlockIndex const& index) const {
+            return region_.contains(index) && isOccupiedAt(region_.localIdOf(index));
+        }
+
+        [[nodiscard]]
+        bool isOccupiedAt(std::size_t localId) const {
+            return occupancy_.empty() || occupancy_[localId];
+        }
+
+        [[nodiscard]]
+        Real<u.mass> mass() const {
+            return prototype_.mass();
+        }
+
+        [[nodiscard]]
+        MaterialIndex materialId() const {
+            return prototype_.materialId();
+        }
+
+        [[nodiscard]]
+        PressureStress const& maxPressureStress() const {
+            return prototype_.maxPressureStress();
+        }
+
+        [[nodiscard]]
+        BlockRegion const& region() const {
+            return region_;
+        }
+    private:
+        BlockRegion region_;
+        BlockConstructionInfo prototype_;
+        std::vector<bool> occupancy_;
+        std::size_t blockCount_;
+    };
+}
@@ -38,8 +38,10 @@
 #include <gustave/core/scenes/common/UserDataTraits.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/StructureData.hpp>
 #include <gustave/core/scenes/cuboidGridScene/structureReference/Blocks.hpp>
+#include <gustave/core/scenes/cuboidGridScene/structureReference/BlockViews.hpp>
 #include <gustave/core/scenes/cuboidGridScene/structureReference/Contacts.hpp>
 #include <gustave/core/scenes/cuboidGridScene/structureReference/Links.hpp>
+#include <gustave/core/scenes/cuboidGridScene/structureReference/LinkViews.hpp>
 #include <gustave/core/scenes/cuboidGridScene/BlockIndex.hpp>
 #include <gustave/core/scenes/cuboidGridScene/BlockReference.hpp>
 #include <gustave/core/scenes/cuboidGridScene/ContactReference.hpp>
@@ -72,7 +74,9 @@ namespace gustave::core::scenes::cuboidGridScene {
         using UserDataMember = UDTraits::StructureMember;
 
         using BlockIndex = cuboidGridScene::BlockIndex;
+        using BlockViews = structureReference::BlockViews<cfg, UD_>;
         using ContactIndex = cuboidGridScene::ContactIndex;
+        using LinkViews = structureReference::LinkViews<cfg, UD_>;
         using StructureIndex = cfg::StructureIndex<cfg>;
 
         template<bool mut>
@@ -165,6 +169,12 @@ namespace gustave::core::scenes::cuboidGridScene {
             return Blocks<false>{ *data_ };
         }
 
+        // Non-owning iteration, without reference counting. See BlockView.
+        [[nodiscard]]
+        BlockViews blockViews() const {
+            return BlockViews{ *data_ };
+        }
+
         [[nodiscard]]
         CommonUserDataMember& commonUserData()
             requires (isMut_&& UDTraits::hasCommonUserData())
@@ -227,6 +237,12 @@ namespace gustave::core::scenes::cuboidGridScene {
             return Links<false>{ *data_ };
         }
 
+        // Non-owning iteration, without reference counting. See ContactView.
+        [[nodiscard]]
+        LinkViews linkViews() const {
+            return LinkViews{ *data_ };
+        }
+
         [[nodiscard]]
         std::optional<NodeIndex> solverIndexOf(BlockIndex const& index) const {
             return data_->solverIndexOf(index);
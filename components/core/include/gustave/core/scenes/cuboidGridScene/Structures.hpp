@@ -25,11 +25,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <type_traits>
+#include <vector>
 
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/core/scenes/common/cSceneUserData.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/DataNeighbours.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/SceneData.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockRegion.hpp>
 #include <gustave/core/scenes/cuboidGridScene/StructureReference.hpp>
 #include <gustave/utils/ForwardIterator.hpp>
 #include <gustave/utils/NoInit.hpp>
@@ -153,6 +157,19 @@ namespace gustave::core::scenes::cuboidGridScene {
             return {};
         }
 
+        // Structures with at least one block inside region, in unspecified order.
+        [[nodiscard]]
+        std::vector<StructureReference<true>> intersecting(BlockRegion const& region)
+            requires (isMut_)
+        {
+            return doIntersecting(*this, region);
+        }
+
+        [[nodiscard]]
+        std::vector<StructureReference<false>> intersecting(BlockRegion const& region) const {
+            return doIntersecting(*this, region);
+        }
+
         [[nodiscard]]
         std::size_t size() const {
             return data_->structures.size();
@@ -168,6 +185,35 @@ namespace gustave::core::scenes::cuboidGridScene {
             return result;
         }
 
+        [[nodiscard]]
+        static auto doIntersecting(meta::cCvRefOf<Structures> auto&& self, BlockRegion const& region) {
+            using BlockData = SceneData::BlockData;
+            using DataNeighbours = detail::DataNeighbours<libCfg, UD_, false>;
+            using Result = decltype(self.intersecting(region));
+            SceneData const& data = *self.data_;
+            std::vector<StructureIndex> ids;
+            data.blockChunks.forEachIn(region, [&](BlockData const& block) {
+                if (block.isFoundation()) {
+                    for (auto const& neighbour : DataNeighbours{ data, block }) {
+                        if (!neighbour.otherBlock().isFoundation()) {
+                            ids.push_back(neighbour.otherBlock().structureId());
+                        }
+                    }
+                } else {
+                    ids.push_back(block.structureId());
+                }
+            });
+            std::ranges::sort(ids);
+            auto const duplicates = std::ranges::unique(ids);
+            ids.erase(duplicates.begin(), duplicates.end());
+            Result result;
+            result.reserve(ids.size());
+            for (StructureIndex const id : ids) {
+                result.emplace_back(*self.data_, id);
+            }
+            return result;
+        }
+
         PropPtr<SceneData> data_;
     };
 }
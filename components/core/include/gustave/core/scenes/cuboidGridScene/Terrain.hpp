@@ -0,0 +1,91 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/model/Stress.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockIndex.hpp>
+
+namespace gustave::core::scenes::cuboidGridScene {
+    // Implicit foundation: every cell where isGround() is true acts as a foundation block, without being
+    // stored in the scene. Each structure touching the ground gets a single foundation node for all its
+    // ground contacts. The predicate can be called concurrently.
+    template<cfg::cLibConfig auto libCfg>
+    class Terrain {
+    private:
+        static constexpr auto u = cfg::units(libCfg);
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
+    public:
+        using BlockIndex = cuboidGridScene::BlockIndex;
+        using Coord = BlockIndex::Coord;
+        using PressureStress = model::PressureStress<libCfg>;
+        using Predicate = std::function<bool(BlockIndex const&)>;
+
+        [[nodiscard]]
+        explicit Terrain(Predicate isGround, PressureStress const& maxPressureStress)
+            : isGround_{ std::move(isGround) }
+            , maxPressureStress_{ maxPressureStress }
+        {
+            if (!isGround_) {
+                throw std::invalid_argument("Expected a non-empty ground predicate.");
+            }
+            maxPressureStress_.checkStrictlyPositive("maxPressureStress");
+        }
+
+        // Cells with index.y < height(index.x, index.z) are ground.
+        [[nodiscard]]
+        static Terrain heightField(std::function<Coord(Coord, Coord)> height, PressureStress const& maxPressureStress) {
+            if (!height) {
+                throw std::invalid_argument("Expected a non-empty height function.");
+            }
+            auto isGround = [height = std::move(height)](BlockIndex const& index) {
+                return index.y < height(index.x, index.z);
+            };
+            return Terrain{ std::move(isGround), maxPressureStress };
+        }
+
+        [[nodiscard]]
+        bool isGround(BlockIndex const& index) const {
+            return isGround_(index);
+        }
+
+        [[nodiscard]]
+        PressureStress const& maxPressureStress() const {
+            return maxPressureStress_;
+        }
+    private:
+        Predicate isGround_;
+        PressureStress maxPressureStress_;
+    };
+}
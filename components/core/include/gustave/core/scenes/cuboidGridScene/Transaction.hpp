@@ -28,10 +28,15 @@
 #include <sstream>
 #include <stdexcept>
 #include <unordered_set>
+#include <vector>
 
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/cfg/LibTraits.hpp>
 #include <gustave/core/scenes/cuboidGridScene/BlockConstructionInfo.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockModification.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockRegion.hpp>
+#include <gustave/core/scenes/cuboidGridScene/MaterialChange.hpp>
+#include <gustave/core/scenes/cuboidGridScene/RegionFill.hpp>
 #include <gustave/utils/getter.hpp>
 #include <gustave/utils/HashEquals.hpp>
 
@@ -40,11 +45,19 @@ namespace gustave::core::scenes::cuboidGridScene {
     class Transaction {
     public:
         using BlockConstructionInfo = cuboidGridScene::BlockConstructionInfo<cfg>;
+        using BlockModification = cuboidGridScene::BlockModification<cfg>;
+        using MaterialChange = cuboidGridScene::MaterialChange<cfg>;
+        using RegionFill = cuboidGridScene::RegionFill<cfg>;
     private:
         using ConstructionHashEquals = utils::HashEquals<BlockConstructionInfo, utils::getter(&BlockConstructionInfo::index)>;
+        using ModificationHashEquals = utils::HashEquals<BlockModification, utils::getter(&BlockModification::index)>;
     public:
         using ConstructionSet = ConstructionHashEquals::Set;
+        using ModifiedSet = ModificationHashEquals::Set;
         using DeletedSet = std::unordered_set<BlockIndex>;
+        using ClearedRegions = std::vector<BlockRegion>;
+        using MaterialChanges = std::vector<MaterialChange>;
+        using RegionFills = std::vector<RegionFill>;
 
         [[nodiscard]]
         Transaction() = default;
@@ -58,10 +71,54 @@ namespace gustave::core::scenes::cuboidGridScene {
             }
         }
 
+        // Removes every existing block inside the region. Applied before all insertions.
+        void clearRegion(BlockRegion const& region) {
+            clearedRegions_.push_back(region);
+        }
+
+        // Applied after all insertions and deletions, in call order.
+        void changeMaterial(MaterialChange const& change) {
+            materialChanges_.push_back(change);
+        }
+
+        void fillRegion(RegionFill const& fill) {
+            regionFills_.push_back(fill);
+        }
+
+        // Applied after material changes. The block must still exist after the deletions of this transaction.
+        void modifyBlock(BlockModification const& modification) {
+            auto opResult = modifiedBlocks_.insert(modification);
+            if (!opResult.second) {
+                std::stringstream stream;
+                stream << "Duplicate modification at " << modification.index() << '.';
+                throw std::invalid_argument(stream.str());
+            }
+        }
+
         void removeBlock(BlockIndex const& index) {
             deletedBlocks_.insert(index);
         }
 
+        [[nodiscard]]
+        ClearedRegions const& clearedRegions() const {
+            return clearedRegions_;
+        }
+
+        [[nodiscard]]
+        MaterialChanges const& materialChanges() const {
+            return materialChanges_;
+        }
+
+        [[nodiscard]]
+        RegionFills const& regionFills() const {
+            return regionFills_;
+        }
+
+        [[nodiscard]]
+        ModifiedSet const& modifiedBlocks() const {
+            return modifiedBlocks_;
+        }
+
         [[nodiscard]]
         ConstructionSet const& newBlocks() const {
             return newBlocks_;
@@ -75,9 +132,17 @@ namespace gustave::core::scenes::cuboidGridScene {
         void clear() {
             newBlocks_.clear();
             deletedBlocks_.clear();
+            clearedRegions_.clear();
+            regionFills_.clear();
+            materialChanges_.clear();
+            modifiedBlocks_.clear();
         }
     private:
         ConstructionSet newBlocks_;
         DeletedSet deletedBlocks_;
+        ClearedRegions clearedRegions_;
+        RegionFills regionFills_;
+        MaterialChanges materialChanges_;
+        ModifiedSet modifiedBlocks_;
     };
 }
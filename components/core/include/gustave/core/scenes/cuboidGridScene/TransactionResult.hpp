@@ -39,12 +39,14 @@ namespace gustave::core::scenes::cuboidGridScene {
         using StructureIndex = cfg::StructureIndex<libcfg>;
 
         using DeletedSet = std::vector<StructureIndex>;
+        using ModifiedSet = std::vector<StructureIndex>;
         using NewSet = utils::IndexRange<StructureIndex>;
 
         [[nodiscard]]
-        explicit TransactionResult(NewSet const& newStructures, DeletedSet deletedStructures)
+        explicit TransactionResult(NewSet const& newStructures, DeletedSet deletedStructures, ModifiedSet modifiedStructures = {})
             : newStructures_{ newStructures }
             , deletedStructures_{ std::move(deletedStructures) }
+            , modifiedStructures_{ std::move(modifiedStructures) }
         {}
 
         [[nodiscard]]
@@ -56,8 +58,15 @@ namespace gustave::core::scenes::cuboidGridScene {
         DeletedSet const& deletedStructures() const {
             return deletedStructures_;
         }
+
+        // Structures that kept their index, but whose solver structure was replaced (new masses or conductivities).
+        [[nodiscard]]
+        ModifiedSet const& modifiedStructures() const {
+            return modifiedStructures_;
+        }
     private:
         NewSet newStructures_;
         DeletedSet deletedStructures_;
+        ModifiedSet modifiedStructures_;
     };
 }
@@ -99,6 +99,7 @@ namespace gustave::core::scenes::cuboidGridScene::blockReference {
         };
     }
 
+    // Contacts of a block, including its ground contacts.
     template<cfg::cLibConfig auto libCfg_, common::cSceneUserData UD_, bool isMut_>
     class Contacts {
     public:
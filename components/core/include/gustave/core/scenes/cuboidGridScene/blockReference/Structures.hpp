@@ -117,7 +117,7 @@ namespace gustave::core::scenes::cuboidGridScene::blockReference {
             : block_{ &blockData }
         {
             if (blockData.isFoundation()) {
-                for (auto const& neighbour : DataNeighbours{ blockData.sceneData(), blockData.index()}) {
+                for (auto const& neighbour : DataNeighbours{ blockData.sceneData(), blockData }) {
                     auto const& nBlockData = neighbour.otherBlock();
                     if (!nBlockData.isFoundation()) {
                         addValue(nBlockData.structureId());
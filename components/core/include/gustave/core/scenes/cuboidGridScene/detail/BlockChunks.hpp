@@ -0,0 +1,133 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/core/scenes/common/cSceneUserData.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/BlockData.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/ChunkGrid.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockIndex.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockRegion.hpp>
+#include <gustave/utils/FlatHashMap.hpp>
+
+namespace gustave::core::scenes::cuboidGridScene::detail {
+    // Spatial index of the blocks of a scene: buckets of blocks, one per cubic chunk of the grid.
+    template<cfg::cLibConfig auto libCfg, common::cSceneUserData UD_>
+    class BlockChunks {
+    public:
+        using BlockData = detail::BlockData<libCfg, UD_>;
+        using Coord = BlockIndex::Coord;
+    private:
+        using Bucket = std::vector<BlockData*>;
+        using Buckets = utils::FlatHashMap<BlockIndex, Bucket>;
+    public:
+        void erase(BlockData& block) {
+            BlockIndex const chunkId = ChunkGrid::chunkIdOf(block.index());
+            auto& bucket = buckets_.at(chunkId);
+            auto const it = std::ranges::find(bucket, &block);
+            assert(it != bucket.end());
+            *it = bucket.back();
+            bucket.pop_back();
+            if (bucket.empty()) {
+                buckets_.erase(chunkId);
+            }
+        }
+
+        // Calls visitor(BlockData&) on each indexed block inside region.
+        template<typename Visitor>
+        void forEachIn(BlockRegion const& region, Visitor&& visitor) {
+            forEachPtrIn(region, [&](BlockData* block) { visitor(*block); });
+        }
+
+        // Calls visitor(BlockData const&) on each indexed block inside region.
+        template<typename Visitor>
+        void forEachIn(BlockRegion const& region, Visitor&& visitor) const {
+            forEachPtrIn(region, [&](BlockData const* block) { visitor(*block); });
+        }
+
+        void insert(BlockData& block) {
+            auto const res = buckets_.tryEmplace(ChunkGrid::chunkIdOf(block.index()));
+            (*res.first).second.push_back(&block);
+        }
+
+        [[nodiscard]]
+        std::size_t chunkCount() const {
+            return buckets_.size();
+        }
+    private:
+        // True if region.volume() <= maxVolume. Doesn't compute the volume, which can overflow.
+        [[nodiscard]]
+        static bool hasVolumeAtMost(BlockRegion const& region, std::size_t maxVolume) {
+            std::size_t volume = 1;
+            for (std::size_t const size : { region.sizeX(), region.sizeY(), region.sizeZ() }) {
+                if (size > maxVolume / volume) {
+                    return false;
+                }
+                volume *= size;
+            }
+            return true;
+        }
+
+        void forEachPtrIn(BlockRegion const& region, auto&& func) const {
+            BlockIndex const minChunk = ChunkGrid::chunkIdOf(region.minIndex());
+            BlockIndex const maxChunk = ChunkGrid::chunkIdOf(region.maxIndex());
+            auto visitBucket = [&](Bucket const& bucket) {
+                for (BlockData* block : bucket) {
+                    if (region.contains(block->index())) {
+                        func(block);
+                    }
+                }
+            };
+            auto const chunkRegion = BlockRegion{ minChunk, maxChunk };
+            if (hasVolumeAtMost(chunkRegion, buckets_.size())) {
+                for (Coord z = minChunk.z; z <= maxChunk.z; ++z) {
+                    for (Coord y = minChunk.y; y <= maxChunk.y; ++y) {
+                        for (Coord x = minChunk.x; x <= maxChunk.x; ++x) {
+                            auto const it = buckets_.find({ x, y, z });
+                            if (it != buckets_.end()) {
+                                visitBucket((*it).second);
+                            }
+                        }
+                    }
+                }
+            } else {
+                for (auto const& [chunkId, bucket] : buckets_) {
+                    if (chunkRegion.contains(chunkId)) {
+                        visitBucket(bucket);
+                    }
+                }
+            }
+        }
+
+        Buckets buckets_;
+    };
+}
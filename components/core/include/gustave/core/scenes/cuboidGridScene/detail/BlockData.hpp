@@ -26,6 +26,7 @@
 #pragma once
 
 #include <cassert>
+#include <cstdint>
 #include <limits>
 
 #include <gustave/cfg/cLibConfig.hpp>
@@ -37,6 +38,7 @@
 #include <gustave/core/scenes/cuboidGridScene/BlockConstructionInfo.hpp>
 #include <gustave/core/scenes/cuboidGridScene/BlockIndex.hpp>
 #include <gustave/core/scenes/cuboidGridScene/forwardDecls.hpp>
+#include <gustave/math3d/BasicDirection.hpp>
 #include <gustave/utils/IndexGenerator.hpp>
 #include <gustave/utils/prop/Ptr.hpp>
 
@@ -54,7 +56,10 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
     public:
         using BlockConstructionInfo = cuboidGridScene::BlockConstructionInfo<libCfg>;
         using BlockIndex = cuboidGridScene::BlockIndex;
+        using Direction = math3d::BasicDirection;
         using LinkIndex = cfg::LinkIndex<libCfg>;
+        using MaterialIndex = BlockConstructionInfo::MaterialIndex;
+        using NeighbourMask = std::uint8_t;
         using PressureStress = model::PressureStress<libCfg>;
         using SceneData = detail::SceneData<libCfg, UD_>;
         using StructureIndex = cfg::StructureIndex<libCfg>;
@@ -72,6 +77,8 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
             , maxPressureStress_{ info.maxPressureStress() }
             , linkIndices_{ maxLinkId(), maxLinkId(), maxLinkId() }
             , mass_{ info.mass() }
+            , materialId_{ info.materialId() }
+            , neighbourMask_{ 0 }
             , isFoundation_{ info.isFoundation() }
             , isValid_{ true }
             , structureId_{ utils::IndexGenerator<StructureIndex>::invalidIndex() }
@@ -90,6 +97,25 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
             return linkIndices_;
         }
 
+        [[nodiscard]]
+        bool hasNeighbourAlong(Direction direction) const {
+            return (neighbourMask_ & bitOf(direction)) != 0;
+        }
+
+        // Bit i is set if a block exists along the direction of id i.
+        [[nodiscard]]
+        NeighbourMask neighbourMask() const {
+            return neighbourMask_;
+        }
+
+        void setNeighbourAlong(Direction direction, bool hasNeighbour) {
+            if (hasNeighbour) {
+                neighbourMask_ |= bitOf(direction);
+            } else {
+                neighbourMask_ &= NeighbourMask(~bitOf(direction));
+            }
+        }
+
         [[nodiscard]]
         BlockIndex const& index() const {
             return index_;
@@ -115,11 +141,25 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
             return mass_;
         }
 
+        [[nodiscard]]
+        MaterialIndex materialId() const {
+            return materialId_;
+        }
+
         [[nodiscard]]
         PressureStress const& maxPressureStress() const {
             return maxPressureStress_;
         }
 
+        void setMass(Real<u.mass> value) {
+            assert(value > 0.f * u.mass);
+            mass_ = value;
+        }
+
+        void setMaxPressureStress(PressureStress const& value) {
+            maxPressureStress_ = value;
+        }
+
         [[nodiscard]]
         SceneData& sceneData() {
             return *scene_;
@@ -158,6 +198,11 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
             return userData_;
         }
     private:
+        [[nodiscard]]
+        static constexpr NeighbourMask bitOf(Direction direction) {
+            return NeighbourMask(1u << static_cast<unsigned>(direction.id()));
+        }
+
         [[nodiscard]]
         static constexpr LinkIndex maxLinkId() {
             return std::numeric_limits<LinkIndex>::max();
@@ -167,6 +212,8 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
         PressureStress maxPressureStress_;
         LinkIndices linkIndices_;
         Real<u.mass> mass_;
+        MaterialIndex materialId_;
+        NeighbourMask neighbourMask_;
         bool isFoundation_;
         bool isValid_;
 
@@ -0,0 +1,55 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <gustave/core/scenes/cuboidGridScene/BlockIndex.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockRegion.hpp>
+
+namespace gustave::core::scenes::cuboidGridScene::detail {
+    // Partition of the grid in cubic chunks, shared by the scene's spatial index and the world snapshots.
+    class ChunkGrid {
+    public:
+        using Coord = BlockIndex::Coord;
+
+        // Chunks are cubes of (1 << chunkShift()) blocks along each axis.
+        [[nodiscard]]
+        static constexpr unsigned chunkShift() {
+            return 4;
+        }
+
+        [[nodiscard]]
+        static BlockIndex chunkIdOf(BlockIndex const& index) {
+            return { index.x >> chunkShift(), index.y >> chunkShift(), index.z >> chunkShift() };
+        }
+
+        [[nodiscard]]
+        static BlockRegion chunkRegionOf(BlockIndex const& chunkId) {
+            constexpr Coord size = Coord{ 1 } << chunkShift();
+            BlockIndex const minIndex{ chunkId.x * size, chunkId.y * size, chunkId.z * size };
+            return BlockRegion{ minIndex, { minIndex.x + (size - 1), minIndex.y + (size - 1), minIndex.z + (size - 1) } };
+        }
+    };
+}
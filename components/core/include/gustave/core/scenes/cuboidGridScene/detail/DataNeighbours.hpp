@@ -25,6 +25,8 @@
 
 #pragma once
 
+#include <cassert>
+
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/core/scenes/common/cSceneUserData.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/DataNeighbour.hpp>
@@ -43,6 +45,7 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
     public:
         using SceneData = detail::SceneData<cfg, UD_>;
 
+        using BlockData = SceneData::BlockData;
         using Neighbour = DataNeighbour<cfg, UD_, isMut_>;
     private:
         template<typename T>
@@ -54,9 +57,14 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
         using EndIterator = Values::ConstIterator;
 
         [[nodiscard]]
-        explicit DataNeighbours(Prop<SceneData>& scene, BlockIndex const& source) {
-            for (auto const& indexNeighbour : IndexNeighbours{ source }) {
-                if (auto neighbour = scene.blocks.find(indexNeighbour.index)) {
+        explicit DataNeighbours(Prop<SceneData>& scene, BlockData const& source) {
+            if (source.neighbourMask() == 0) {
+                return;
+            }
+            for (auto const& indexNeighbour : IndexNeighbours{ source.index() }) {
+                if (source.hasNeighbourAlong(indexNeighbour.direction)) {
+                    auto neighbour = scene.blocks.find(indexNeighbour.index);
+                    assert(neighbour);
                     values_.emplaceBack(indexNeighbour.direction, *neighbour);
                 }
             }
@@ -0,0 +1,89 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/core/scenes/common/cSceneUserData.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/IndexNeighbours.hpp>
+#include <gustave/core/scenes/cuboidGridScene/forwardDecls.hpp>
+#include <gustave/math3d/BasicDirection.hpp>
+#include <gustave/utils/InplaceVector.hpp>
+#include <gustave/utils/NoInit.hpp>
+
+namespace gustave::core::scenes::cuboidGridScene::detail {
+    // Directions along which a non-foundation block touches the terrain, in IndexNeighbours order.
+    // The solver links of these contacts are consecutive, in the same order.
+    template<cfg::cLibConfig auto cfg, common::cSceneUserData UD_>
+    class GroundLinks {
+    public:
+        using SceneData = detail::SceneData<cfg, UD_>;
+
+        using BlockData = SceneData::BlockData;
+        using Direction = math3d::BasicDirection;
+
+        using Values = utils::InplaceVector<Direction, 6>;
+        using Iterator = Values::ConstIterator;
+
+        [[nodiscard]]
+        explicit GroundLinks(utils::NoInit) {}
+
+        [[nodiscard]]
+        explicit GroundLinks(SceneData const& scene, BlockData const& block) {
+            if (!scene.terrain() || block.isFoundation()) {
+                return;
+            }
+            for (auto const& neighbour : IndexNeighbours{ block.index() }) {
+                if (!block.hasNeighbourAlong(neighbour.direction) && scene.isGround(neighbour.index)) {
+                    values_.pushBack(neighbour.direction);
+                }
+            }
+        }
+
+        [[nodiscard]]
+        Direction operator[](std::size_t index) const {
+            return values_[index];
+        }
+
+        [[nodiscard]]
+        Iterator begin() const {
+            return values_.begin();
+        }
+
+        [[nodiscard]]
+        Iterator end() const {
+            return values_.end();
+        }
+
+        [[nodiscard]]
+        std::size_t size() const {
+            return values_.size();
+        }
+    private:
+        Values values_;
+    };
+}
@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include <cassert>
 #include <optional>
 
 #include <gustave/core/scenes/common/cSceneUserData.hpp>
@@ -57,11 +58,14 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
             : source_{ &scene.blocks.at(blockIndex) }
         {
             auto processNeighbour = [&](Direction direction) {
+                if (!source_->hasNeighbourAlong(direction)) {
+                    return;
+                }
                 if (auto neighbourId = blockIndex.neighbourAlong(direction)) {
-                    if (auto neighbourPtr = scene.blocks.find(*neighbourId)) {
-                        if (!source_->isFoundation() || !neighbourPtr->isFoundation()) {
-                            values_.emplaceBack(direction, *neighbourPtr);
-                        }
+                    auto neighbourPtr = scene.blocks.find(*neighbourId);
+                    assert(neighbourPtr);
+                    if (!source_->isFoundation() || !neighbourPtr->isFoundation()) {
+                        values_.emplaceBack(direction, *neighbourPtr);
                     }
                 }
             };
@@ -26,18 +26,22 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <stdexcept>
+#include <utility>
 
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/cfg/LibTraits.hpp>
 #include <gustave/core/scenes/common/cSceneUserData.hpp>
 #include <gustave/core/scenes/common/UserDataTraits.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/BlockChunks.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/BlockData.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/StructureData.hpp>
 #include <gustave/core/scenes/cuboidGridScene/forwardDecls.hpp>
-#include <gustave/utils/SharedIndexedSet.hpp>
+#include <gustave/core/scenes/cuboidGridScene/Terrain.hpp>
 #include <gustave/utils/IndexGenerator.hpp>
 #include <gustave/utils/PointerHash.hpp>
+#include <gustave/utils/SharedSlotMap.hpp>
 
 namespace gustave::core::scenes::cuboidGridScene::detail {
     template<cfg::cLibConfig auto cfg, common::cSceneUserData UD_>
@@ -50,6 +54,7 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
         using Direction = math3d::BasicDirection;
         using StructureData = detail::StructureData<cfg, UD_>;
         using StructureIndex = cfg::StructureIndex<cfg>;
+        using Terrain = cuboidGridScene::Terrain<cfg>;
     private:
         static constexpr auto u = cfg::units(cfg);
 
@@ -61,9 +66,10 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
         template<cfg::cUnitOf<cfg> auto unit>
         using Real = cfg::Real<cfg, unit>;
     public:
-        using Blocks = utils::SharedIndexedSet<BlockData>;
+        using BlockChunks = detail::BlockChunks<cfg, UD_>;
+        using Blocks = utils::SharedSlotMap<BlockData>;
         using StructureIdGenerator = utils::IndexGenerator<StructureIndex>;
-        using Structures = utils::SharedIndexedSet<StructureData>;
+        using Structures = utils::SharedSlotMap<StructureData>;
         using UserDataMember = UDTraits::CommonMember;
 
         [[nodiscard]]
@@ -81,16 +87,25 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
             }
         }
 
+        [[nodiscard]]
+        explicit SceneData(Vector3<u.length> const& blockSize, Terrain terrain)
+            : SceneData{ blockSize }
+        {
+            terrain_.emplace(std::move(terrain));
+        }
+
         SceneData(SceneData const&) = delete;
         SceneData& operator=(SceneData const&) = delete;
 
         [[nodiscard]]
         SceneData(SceneData&& other)
             : blocks{ std::move(other.blocks) }
+            , blockChunks{ std::move(other.blockChunks) }
             , structures{ std::move(other.structures) }
             , structureIdGenerator{ other.structureIdGenerator }
             , userData_{ std::move(other.userData_ ) }
             , blockSize_{ std::move(other.blockSize_) }
+            , terrain_{ std::move(other.terrain_) }
         {
             resetSceneDataPtr();
         }
@@ -98,10 +113,12 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
         SceneData& operator=(SceneData&& other) {
             if (&other != this) {
                 blocks = std::move(other.blocks);
+                blockChunks = std::move(other.blockChunks);
                 structures = std::move(other.structures);
                 structureIdGenerator = other.structureIdGenerator;
                 userData_ = std::move(other.userData_);
                 blockSize_ = other.blockSize_;
+                terrain_ = std::move(other.terrain_);
                 resetSceneDataPtr();
             }
             return *this;
@@ -129,6 +146,11 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
             throw direction.invalidError();
         }
 
+        [[nodiscard]]
+        bool isGround(BlockIndex const& index) const {
+            return terrain_ && terrain_->isGround(index);
+        }
+
         [[nodiscard]]
         bool isStructureValid(StructureData const* structure) const {
             return structure != nullptr && structures.contains(structure);
@@ -139,6 +161,11 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
             return id != structureIdGenerator.invalidIndex() && structures.contains(id);
         }
 
+        [[nodiscard]]
+        std::optional<Terrain> const& terrain() const {
+            return terrain_;
+        }
+
         [[nodiscard]]
         Real<u.length> thicknessAlong(Direction direction) const {
             switch (direction.id()) {
@@ -170,6 +197,7 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
         }
 
         Blocks blocks;
+        BlockChunks blockChunks;
         Structures structures;
         StructureIdGenerator structureIdGenerator;
     private:
@@ -192,5 +220,6 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
         [[no_unique_address]]
         UserDataMember userData_;
         Vector3<u.length> blockSize_;
+        std::optional<Terrain> terrain_;
     };
 }
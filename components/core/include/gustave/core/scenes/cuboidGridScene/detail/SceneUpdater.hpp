@@ -25,10 +25,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
 #include <memory>
 #include <stack>
 #include <sstream>
 #include <stdexcept>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -37,13 +42,17 @@
 #include <gustave/cfg/LibTraits.hpp>
 #include <gustave/core/scenes/common/cSceneUserData.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/DataNeighbours.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/IndexNeighbours.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/SceneData.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/StructureData.hpp>
 #include <gustave/core/scenes/cuboidGridScene/BlockIndex.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockRegion.hpp>
 #include <gustave/core/scenes/cuboidGridScene/Transaction.hpp>
 #include <gustave/core/scenes/cuboidGridScene/TransactionResult.hpp>
+#include <gustave/utils/cExecutor.hpp>
 #include <gustave/utils/IndexRange.hpp>
 #include <gustave/utils/prop/Ptr.hpp>
+#include <gustave/utils/SerialExecutor.hpp>
 
 namespace gustave::core::scenes::cuboidGridScene::detail {
     template<cfg::cLibConfig auto libCfg, common::cSceneUserData UD_>
@@ -56,6 +65,10 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
         static constexpr auto u = cfg::units(libCfg);
 
         using BlockConstructionInfo = Transaction::BlockConstructionInfo;
+        using BlockModification = Transaction::BlockModification;
+        using Direction = math3d::BasicDirection;
+        using MaterialChange = Transaction::MaterialChange;
+        using RegionFill = Transaction::RegionFill;
         using BlockData = SceneData::BlockData;
         using ConstDataNeighbours = detail::DataNeighbours<libCfg, UD_, false>;
         using DataNeighbours = detail::DataNeighbours<libCfg, UD_, true>;
@@ -66,6 +79,7 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
         using Real = cfg::Real<libCfg, unit>;
 
         struct TransactionContext {
+            std::unordered_set<BlockData*> modifiedBlocks;
             std::unordered_set<BlockData*> newRoots;
             std::vector<StructureIndex> removedStructures;
         };
@@ -77,31 +91,64 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
         {}
 
         TransactionResult runTransaction(Transaction const& transaction) {
+            utils::SerialExecutor executor;
+            return runTransaction(transaction, executor);
+        }
+
+        TransactionResult runTransaction(Transaction const& transaction, utils::cExecutor auto& executor) {
             checkTransaction(transaction);
             TransactionContext ctx;
             for (auto const& delBlockId : transaction.deletedBlocks()) {
                 removeBlock(ctx, delBlockId);
             }
+            for (auto const& region : transaction.clearedRegions()) {
+                clearRegion(ctx, region);
+            }
             for (auto const& newBlockInfo : transaction.newBlocks()) {
                 addBlock(ctx, newBlockInfo);
             }
+            for (auto const& fill : transaction.regionFills()) {
+                fillRegion(ctx, fill);
+            }
+            for (auto const& change : transaction.materialChanges()) {
+                changeMaterial(ctx, change);
+            }
+            for (auto const& modification : transaction.modifiedBlocks()) {
+                modifyBlock(ctx, modification);
+            }
             auto const newIdStart = data_->structureIdGenerator.readNextIndex();
+            auto const isLabelled = [&](BlockData const& block) {
+                auto const structId = block.structureId();
+                return data_->isStructureIdValid(structId)
+                    || (structId != data_->structureIdGenerator.invalidIndex() && structId >= newIdStart);
+            };
+            std::vector<std::vector<BlockData*>> components;
             for (auto rootPtr : ctx.newRoots) {
                 auto& root = *rootPtr;
                 assert(!root.isFoundation());
-                if (!data_->isStructureIdValid(root.structureId())) {
+                if (!isLabelled(root)) {
                     auto const newStructId = data_->structureIdGenerator();
-                    auto newStructure = std::make_shared<StructureData>(newStructId, *data_, root);
-                    data_->structures.insert(std::move(newStructure));
+                    components.push_back(StructureData::labelBlocks(newStructId, *data_, root));
                 }
             }
+            std::vector<std::shared_ptr<StructureData>> newStructures(components.size());
+            executor.parallelFor(components.size(), [&](std::size_t compId) {
+                auto const structId = StructureIndex(newIdStart + compId);
+                newStructures[compId] = std::make_shared<StructureData>(structId, *data_, components[compId]);
+            });
+            for (auto& newStructure : newStructures) {
+                data_->structures.insert(std::move(newStructure));
+            }
             auto const newIdEnd = data_->structureIdGenerator.readNextIndex();
             auto const newStructureIds = utils::IndexRange<StructureIndex>{ newIdStart, newIdEnd - newIdStart };
-            return TransactionResult{ newStructureIds, std::move(ctx.removedStructures) };
+            auto modifiedStructureIds = updateModifiedStructures(ctx, newIdStart, executor);
+            return TransactionResult{ newStructureIds, std::move(ctx.removedStructures), std::move(modifiedStructureIds) };
         }
     private:
         void addBlock(TransactionContext& ctx, BlockConstructionInfo const& newInfo) {
             auto& newBlock = data_->blocks.emplace(newInfo, *data_);
+            data_->blockChunks.insert(newBlock);
+            linkNeighbourMasks(newBlock);
             if (newBlock.isFoundation()) {
                 for (auto const& neighbour : neighbours(newBlock)) {
                     declareRoot(ctx, neighbour.otherBlock());
@@ -114,6 +161,17 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
             }
         }
 
+        void changeMaterial(TransactionContext& ctx, MaterialChange const& change) {
+            for (auto const& blockPtr : data_->blocks) {
+                auto& block = *blockPtr;
+                if (block.materialId() == change.materialId()) {
+                    block.setMaxPressureStress(change.newMaxPressureStress());
+                    block.setMass(block.mass() * change.massFactor());
+                    ctx.modifiedBlocks.insert(&block);
+                }
+            }
+        }
+
         void checkTransaction(Transaction const& transaction) const {
             auto const& deletedBlocks = transaction.deletedBlocks();
             for (BlockIndex const& delIndex : deletedBlocks) {
@@ -123,19 +181,173 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
                     throw std::invalid_argument(stream.str());
                 }
             }
-            for (BlockConstructionInfo const& newBlock : transaction.newBlocks()) {
-                BlockIndex const& index = newBlock.index();
-                if (data_->blocks.contains(index) && !deletedBlocks.contains(index)) {
+            auto checkInsertion = [&](BlockIndex const& index) {
+                if (data_->blocks.contains(index) && !deletedBlocks.contains(index) && !isInClearedRegion(transaction, index)) {
                     std::stringstream stream;
                     stream << "Invalid insertion at " << index << ": block already exists in the scene.";
                     throw std::invalid_argument(stream.str());
                 }
+                if (data_->isGround(index)) {
+                    std::stringstream stream;
+                    stream << "Invalid insertion at " << index << ": position is inside the terrain.";
+                    throw std::invalid_argument(stream.str());
+                }
+            };
+            for (BlockModification const& modification : transaction.modifiedBlocks()) {
+                BlockIndex const& index = modification.index();
+                if (!data_->blocks.contains(index) || deletedBlocks.contains(index) || isInClearedRegion(transaction, index)) {
+                    std::stringstream stream;
+                    stream << "Invalid modification at " << index << ": block does not exist in the scene.";
+                    throw std::invalid_argument(stream.str());
+                }
+            }
+            auto const& fills = transaction.regionFills();
+            for (BlockConstructionInfo const& newBlock : transaction.newBlocks()) {
+                BlockIndex const& index = newBlock.index();
+                checkInsertion(index);
+                for (RegionFill const& fill : fills) {
+                    if (fill.isOccupied(index)) {
+                        throw duplicateInsertionError(index);
+                    }
+                }
+            }
+            for (std::size_t fillId = 0; fillId < fills.size(); ++fillId) {
+                RegionFill const& fill = fills[fillId];
+                forEachIndexIn(fill.region(), [&](BlockIndex const& index, std::size_t localId) {
+                    if (fill.isOccupiedAt(localId)) {
+                        checkInsertion(index);
+                    }
+                });
+                for (std::size_t otherId = fillId + 1; otherId < fills.size(); ++otherId) {
+                    RegionFill const& otherFill = fills[otherId];
+                    if (auto const overlap = fill.region().intersection(otherFill.region())) {
+                        forEachIndexIn(*overlap, [&](BlockIndex const& index, std::size_t) {
+                            if (fill.isOccupied(index) && otherFill.isOccupied(index)) {
+                                throw duplicateInsertionError(index);
+                            }
+                        });
+                    }
+                }
+            }
+        }
+
+        void clearRegion(TransactionContext& ctx, BlockRegion const& region) {
+            std::vector<BlockData*> clearedBlocks;
+            data_->blockChunks.forEachIn(region, [&](BlockData& block) {
+                clearedBlocks.push_back(&block);
+            });
+            for (BlockData* block : clearedBlocks) {
+                ctx.newRoots.erase(block);
+                removeStructureOf(ctx, *block);
+                for (auto const& neighbour : neighbours(*block)) {
+                    auto& otherBlock = neighbour.otherBlock();
+                    if (!region.contains(otherBlock.index())) {
+                        otherBlock.setNeighbourAlong(neighbour.direction().opposite(), false);
+                        declareRoot(ctx, otherBlock);
+                    }
+                }
+            }
+            for (BlockData* block : clearedBlocks) {
+                BlockIndex const index = block->index();
+                block->invalidate();
+                data_->blockChunks.erase(*block);
+                [[maybe_unused]] bool isDeleted = data_->blocks.erase(index);
+                assert(isDeleted);
             }
         }
 
+        [[nodiscard]]
+        static std::invalid_argument duplicateInsertionError(BlockIndex const& index) {
+            std::stringstream stream;
+            stream << "Invalid insertion at " << index << ": block inserted twice by the transaction.";
+            return std::invalid_argument(stream.str());
+        }
+
+        // Region fast path: links between blocks of the fill are deduced from its occupancy, only the faces
+        // of the region are looked up in the scene. Every structure of the fill is reached from its blocks that
+        // have no filled neighbour along -x, -y and -z, so only these become roots.
+        void fillRegion(TransactionContext& ctx, RegionFill const& fill) {
+            static constexpr auto directions = std::array{
+                Direction::plusX(), Direction::minusX(), Direction::plusY(), Direction::minusY(), Direction::plusZ(), Direction::minusZ(),
+            };
+            BlockRegion const& region = fill.region();
+            forEachIndexIn(region, [&](BlockIndex const& index, std::size_t localId) {
+                if (!fill.isOccupiedAt(localId)) {
+                    return;
+                }
+                auto& newBlock = data_->blocks.emplace(fill.blockAt(index), *data_);
+                data_->blockChunks.insert(newBlock);
+                bool isSeed = true;
+                for (Direction const direction : directions) {
+                    auto const neighbourId = index.neighbourAlong(direction);
+                    if (!neighbourId) {
+                        continue;
+                    }
+                    if (region.contains(*neighbourId)) {
+                        if (fill.isOccupiedAt(region.localIdOf(*neighbourId))) {
+                            newBlock.setNeighbourAlong(direction, true);
+                            if (isNegative(direction)) {
+                                isSeed = false;
+                            }
+                        }
+                    } else if (auto neighbour = data_->blocks.find(*neighbourId)) {
+                        newBlock.setNeighbourAlong(direction, true);
+                        neighbour->setNeighbourAlong(direction.opposite(), true);
+                        if (fill.isFoundation()) {
+                            declareRoot(ctx, *neighbour);
+                        } else {
+                            removeStructureOf(ctx, *neighbour);
+                        }
+                    }
+                }
+                if (isSeed) {
+                    declareRoot(ctx, newBlock);
+                }
+            });
+        }
+
+        static void forEachIndexIn(BlockRegion const& region, auto&& func) {
+            BlockIndex const& minIndex = region.minIndex();
+            BlockIndex const& maxIndex = region.maxIndex();
+            std::size_t localId = 0;
+            for (BlockIndex::Coord z = minIndex.z; z <= maxIndex.z; ++z) {
+                for (BlockIndex::Coord y = minIndex.y; y <= maxIndex.y; ++y) {
+                    for (BlockIndex::Coord x = minIndex.x; x <= maxIndex.x; ++x) {
+                        func(BlockIndex{ x, y, z }, localId);
+                        ++localId;
+                        if (x == maxIndex.x) {
+                            break;
+                        }
+                    }
+                    if (y == maxIndex.y) {
+                        break;
+                    }
+                }
+                if (z == maxIndex.z) {
+                    break;
+                }
+            }
+        }
+
+        [[nodiscard]]
+        static bool isInClearedRegion(Transaction const& transaction, BlockIndex const& index) {
+            for (BlockRegion const& region : transaction.clearedRegions()) {
+                if (region.contains(index)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        [[nodiscard]]
+        static bool isNegative(Direction direction) {
+            auto const id = direction.id();
+            return id == Direction::Id::minusX || id == Direction::Id::minusY || id == Direction::Id::minusZ;
+        }
+
         [[nodiscard]]
         ConstDataNeighbours constNeighbours(BlockData const& source) const {
-            return ConstDataNeighbours{ *data_, source.index() };
+            return ConstDataNeighbours{ *data_, source };
         }
 
         void declareRoot(TransactionContext& ctx, BlockData& possibleRoot) {
@@ -149,22 +361,35 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
 
         [[nodiscard]]
         DataNeighbours neighbours(BlockData& source) {
-            return DataNeighbours{ *data_, source.index() };
+            return DataNeighbours{ *data_, source };
         }
 
-        [[nodiscard]]
-        DataNeighbours neighbours(BlockIndex const& source) {
-            return DataNeighbours{ *data_, source };
+        void linkNeighbourMasks(BlockData& newBlock) {
+            for (auto const& indexNeighbour : IndexNeighbours{ newBlock.index() }) {
+                if (auto neighbour = data_->blocks.find(indexNeighbour.index)) {
+                    newBlock.setNeighbourAlong(indexNeighbour.direction, true);
+                    neighbour->setNeighbourAlong(indexNeighbour.direction.opposite(), true);
+                }
+            }
+        }
+
+        void modifyBlock(TransactionContext& ctx, BlockModification const& modification) {
+            auto& block = data_->blocks.at(modification.index());
+            block.setMaxPressureStress(modification.maxPressureStress());
+            block.setMass(modification.mass());
+            ctx.modifiedBlocks.insert(&block);
         }
 
         void removeBlock(TransactionContext& ctx, BlockIndex const& deletedIndex) {
             auto& deletedBlock = data_->blocks.at(deletedIndex);
             ctx.newRoots.erase(&deletedBlock);
             removeStructureOf(ctx, deletedBlock);
-            for (auto const& neighbour : neighbours(deletedIndex)) {
+            for (auto const& neighbour : neighbours(deletedBlock)) {
+                neighbour.otherBlock().setNeighbourAlong(neighbour.direction().opposite(), false);
                 declareRoot(ctx, neighbour.otherBlock());
             }
             deletedBlock.invalidate();
+            data_->blockChunks.erase(deletedBlock);
             [[maybe_unused]] bool isDeleted = data_->blocks.erase(deletedIndex);
             assert(isDeleted);
         }
@@ -180,6 +405,39 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
             }
         }
 
+        // Structures built by this transaction already read the new block values: only older ones are updated.
+        [[nodiscard]]
+        std::vector<StructureIndex> updateModifiedStructures(TransactionContext const& ctx, StructureIndex newIdStart, utils::cExecutor auto& executor) {
+            std::unordered_map<StructureIndex, std::vector<BlockData const*>> blocksPerStructure;
+            auto const declareModified = [&](StructureIndex structId, BlockData const& block) {
+                if (structId < newIdStart && data_->isStructureIdValid(structId)) {
+                    blocksPerStructure[structId].push_back(&block);
+                }
+            };
+            for (BlockData* blockPtr : ctx.modifiedBlocks) {
+                if (blockPtr->isFoundation()) {
+                    for (auto const& neighbour : constNeighbours(*blockPtr)) {
+                        if (!neighbour.otherBlock().isFoundation()) {
+                            declareModified(neighbour.otherBlock().structureId(), *blockPtr);
+                        }
+                    }
+                } else {
+                    declareModified(blockPtr->structureId(), *blockPtr);
+                }
+            }
+            std::vector<StructureIndex> result;
+            result.reserve(blocksPerStructure.size());
+            for (auto const& entry : blocksPerStructure) {
+                result.push_back(entry.first);
+            }
+            std::ranges::sort(result);
+            executor.parallelFor(result.size(), [&](std::size_t id) {
+                auto const structId = result[id];
+                data_->structures.at(structId).updateBlocks(blocksPerStructure.at(structId));
+            });
+            return result;
+        }
+
         utils::prop::Ptr<SceneData> data_;
     };
 }
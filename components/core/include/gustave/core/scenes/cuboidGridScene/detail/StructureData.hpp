@@ -28,6 +28,7 @@
 #include <cassert>
 #include <memory>
 #include <optional>
+#include <span>
 #include <stack>
 #include <vector>
 
@@ -39,9 +40,11 @@
 #include <gustave/core/scenes/cuboidGridScene/detail/BlockData.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/DataNeighbour.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/DataNeighbours.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/GroundLinks.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/SceneData.hpp>
 #include <gustave/core/scenes/cuboidGridScene/forwardDecls.hpp>
 #include <gustave/core/solvers/Structure.hpp>
+#include <gustave/utils/FlatHashMap.hpp>
 #include <gustave/utils/prop/Ptr.hpp>
 
 namespace gustave::core::scenes::cuboidGridScene::detail {
@@ -53,8 +56,11 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
     private:
         static constexpr auto u = cfg::units(libCfg);
 
+        using ConstDataNeighbour = detail::DataNeighbour<libCfg, UD_, false>;
+        using ConstDataNeighbours = detail::DataNeighbours<libCfg, UD_, false>;
         using DataNeighbour = detail::DataNeighbour<libCfg, UD_, true>;
         using DataNeighbours = detail::DataNeighbours<libCfg, UD_, true>;
+        using GroundLinks = detail::GroundLinks<libCfg, UD_>;
         using Direction = math3d::BasicDirection;
 
         using PressureStress = model::PressureStress<libCfg>;
@@ -71,7 +77,8 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
         using BlockData = SceneData::BlockData;
         using LinkIndex = cfg::LinkIndex<libCfg>;
         using NodeIndex = cfg::NodeIndex<libCfg>;
-        using SolverIndices = std::unordered_map<BlockIndex, NodeIndex>;
+        using GroundLinkIndices = utils::FlatHashMap<BlockIndex, LinkIndex>;
+        using SolverIndices = utils::FlatHashMap<BlockIndex, NodeIndex>;
         using StructureIndex = cfg::StructureIndex<libCfg>;
         using UserDataMember = UDTraits::StructureMember;
 
@@ -82,11 +89,46 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
 
         [[nodiscard]]
         explicit StructureData(StructureIndex index, SceneData& sceneData, BlockData& root)
+            : StructureData{ index, sceneData, labelBlocks(index, sceneData, root) }
+        {}
+
+        // blocks: output of labelBlocks(index, ...). Only reads the scene (and writes link indices of its
+        // own contacts), so structures with distinct labels can be built concurrently.
+        [[nodiscard]]
+        explicit StructureData(StructureIndex index, SceneData& sceneData, std::span<BlockData* const> blocks)
             : index_{ index }
             , scene_{ &sceneData }
             , solverStructure_{ std::make_shared<SolverStructure>() }
             , isValid_{ true }
         {
+            solverIndices_.reserve(blocks.size());
+            for (BlockData* curBlockPtr : blocks) {
+                auto& curBlock = *curBlockPtr;
+                assert(curBlock.structureId() == index);
+                declareBlock(curBlock);
+                for (auto const& neighbour : DataNeighbours{ *scene_, curBlock }) {
+                    auto& nBlock = neighbour.otherBlock();
+                    if (nBlock.isFoundation()) {
+                        declareBlock(nBlock);
+                        addContact(curBlock, neighbour);
+                    } else if (solverIndices_.contains(nBlock.index())) {
+                        addContact(curBlock, neighbour);
+                    }
+                }
+                if (scene_->terrain()) {
+                    addGroundContacts(curBlock);
+                }
+            }
+        }
+
+        StructureData(StructureData const&) = delete;
+        StructureData& operator=(StructureData const&) = delete;
+
+        // Sets the structure id of all non-foundation blocks connected to root.
+        // Returns them in discovery order.
+        [[nodiscard]]
+        static std::vector<BlockData*> labelBlocks(StructureIndex index, SceneData& sceneData, BlockData& root) {
+            std::vector<BlockData*> result;
             std::stack<BlockData*> remainingBlocks;
             remainingBlocks.push(&root);
             while (!remainingBlocks.empty()) {
@@ -94,28 +136,19 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
                 remainingBlocks.pop();
                 assert(not curBlock.isFoundation());
                 if (curBlock.structureId() != index) {
-                    declareBlock(curBlock);
                     curBlock.structureId() = index;
-                    for (auto const& neighbour : DataNeighbours{ *scene_, curBlock.index() }) {
+                    result.push_back(&curBlock);
+                    for (auto const& neighbour : DataNeighbours{ sceneData, curBlock }) {
                         auto& nBlock = neighbour.otherBlock();
-                        if (nBlock.isFoundation()) {
-                            declareBlock(nBlock);
-                            addContact(curBlock, neighbour);
-                        } else {
-                            if (nBlock.structureId() != index) {
-                                remainingBlocks.push(&nBlock);
-                            } else {
-                                addContact(curBlock, neighbour);
-                            }
+                        if (!nBlock.isFoundation() && nBlock.structureId() != index) {
+                            remainingBlocks.push(&nBlock);
                         }
                     }
                 }
             }
+            return result;
         }
 
-        StructureData(StructureData const&) = delete;
-        StructureData& operator=(StructureData const&) = delete;
-
         [[nodiscard]]
         bool contains(BlockIndex const& index) const {
             return isValid_ && solverIndices_.contains(index);
@@ -126,11 +159,78 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
             return index_;
         }
 
+        // Reads the new mass & max stress of blocks, and updates their node and contacts in the solver structure.
+        // The solver structure is updated in place, unless something else still holds it (ex: a solution):
+        // it is then copied first, so that solutions of the previous one stay consistent.
+        void updateBlocks(std::span<BlockData const* const> blocks) {
+            assert(isValid_);
+            if (solverStructure_.use_count() > 1) {
+                solverStructure_ = std::make_shared<SolverStructure>(*solverStructure_);
+            }
+            SolverStructure& structure = *solverStructure_;
+            for (BlockData const* blockPtr : blocks) {
+                auto const& block = *blockPtr;
+                structure.setNodeMass(indexOf(block), block.mass());
+                for (auto const& neighbour : ConstDataNeighbours{ *scene_, block }) {
+                    auto const& nBlock = neighbour.otherBlock();
+                    if (!(block.isFoundation() && nBlock.isFoundation()) && solverIndices_.contains(nBlock.index())) {
+                        updateContact(structure, block, neighbour);
+                    }
+                }
+                auto const groundLinkIt = groundLinkIndices_.find(block.index());
+                if (groundLinkIt != groundLinkIndices_.end()) {
+                    LinkIndex linkId = groundLinkIt->second;
+                    for (Direction const direction : GroundLinks{ *scene_, block }) {
+                        structure.setLinkConductivity(linkId, groundLinkOf(block, direction).conductivity());
+                        ++linkId;
+                    }
+                }
+            }
+        }
+
         void invalidate() {
             assert(isValid_);
             isValid_ = false;
             solverStructure_ = nullptr;
             solverIndices_.clear();
+            groundLinkIndices_.clear();
+            groundNodeIndex_.reset();
+        }
+
+        // Mass of the solver node of the terrain. Foundation masses are ignored by the solver, but nodes
+        // must have a strictly positive mass: this fixed value keeps the node independent of the blocks.
+        [[nodiscard]]
+        static constexpr Real<u.mass> groundNodeMass() {
+            return 1.f * u.mass;
+        }
+
+        // Solver node of the terrain, if this structure touches it.
+        [[nodiscard]]
+        std::optional<NodeIndex> groundNodeIndex() const {
+            return groundNodeIndex_;
+        }
+
+        // Index of the first ground link of each block touching the terrain. The other links of the block
+        // follow, in GroundLinks order.
+        [[nodiscard]]
+        GroundLinkIndices const& groundLinkIndices() const {
+            return groundLinkIndices_;
+        }
+
+        // Solver link of the contact between block and the terrain along direction, if it exists.
+        [[nodiscard]]
+        std::optional<LinkIndex> groundLinkIndexOf(BlockData const& block, Direction direction) const {
+            auto const groundLinkIt = groundLinkIndices_.find(block.index());
+            if (groundLinkIt != groundLinkIndices_.end()) {
+                LinkIndex linkId = groundLinkIt->second;
+                for (Direction const groundDirection : GroundLinks{ *scene_, block }) {
+                    if (groundDirection == direction) {
+                        return linkId;
+                    }
+                    ++linkId;
+                }
+            }
+            return {};
         }
 
         [[nodiscard]]
@@ -193,7 +293,7 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
         }
     private:
         void declareBlock(BlockData const& block) {
-            auto insertResult = solverIndices_.insert({ block.index(), NodeIndex{0} });
+            auto insertResult = solverIndices_.tryEmplace(block.index(), NodeIndex{ 0 });
             if (insertResult.second) {
                 NodeIndex newIndex = solverStructure_->addNode(Node{ block.mass(), block.isFoundation() });
                 insertResult.first->second = newIndex;
@@ -225,12 +325,73 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
             }
         }
 
+        void addGroundContacts(BlockData const& block) {
+            bool isFirst = true;
+            for (Direction const direction : GroundLinks{ *scene_, block }) {
+                if (!groundNodeIndex_) {
+                    groundNodeIndex_ = solverStructure_->addNode(Node{ groundNodeMass(), true });
+                }
+                LinkIndex const linkId = solverStructure_->addLink(groundLinkOf(block, direction));
+                if (isFirst) {
+                    groundLinkIndices_.tryEmplace(block.index(), linkId);
+                    isFirst = false;
+                }
+            }
+        }
+
+        [[nodiscard]]
+        Link groundLinkOf(BlockData const& block, Direction direction) const {
+            assert(groundNodeIndex_);
+            NormalizedVector3 const normal = NormalizedVector3::basisVector(direction);
+            Real<u.area> const area = scene_->contactAreaAlong(direction);
+            Real<u.length> const thickness = scene_->thicknessAlong(direction);
+            PressureStress const maxStress = PressureStress::minStress(block.maxPressureStress(), scene_->terrain()->maxPressureStress());
+            return Link{ indexOf(block), *groundNodeIndex_, normal, area, thickness, maxStress };
+        }
+
         LinkIndex addLink(BlockData const& localNode, BlockData const& otherNode, Direction direction) {
+            return solverStructure_->addLink(linkOf(localNode, otherNode, direction));
+        }
+
+        [[nodiscard]]
+        Link linkOf(BlockData const& localNode, BlockData const& otherNode, Direction direction) const {
             NormalizedVector3 const normal = NormalizedVector3::basisVector(direction);
             Real<u.area> const area = scene_->contactAreaAlong(direction);
             Real<u.length> const thickness = scene_->thicknessAlong(direction);
             PressureStress const maxStress = PressureStress::minStress(localNode.maxPressureStress(), otherNode.maxPressureStress());
-            return solverStructure_->addLink(Link{ indexOf(localNode), indexOf(otherNode), normal, area, thickness, maxStress });
+            return Link{ indexOf(localNode), indexOf(otherNode), normal, area, thickness, maxStress };
+        }
+
+        void updateContact(SolverStructure& structure, BlockData const& source, ConstDataNeighbour const& neighbour) const {
+            auto const direction = neighbour.direction();
+            auto const& nBlock = neighbour.otherBlock();
+            switch (direction.id()) {
+            case Direction::Id::plusX:
+                updateLink(structure, source.linkIndices().plusX, source, nBlock, direction);
+                break;
+            case Direction::Id::plusY:
+                updateLink(structure, source.linkIndices().plusY, source, nBlock, direction);
+                break;
+            case Direction::Id::plusZ:
+                updateLink(structure, source.linkIndices().plusZ, source, nBlock, direction);
+                break;
+            case Direction::Id::minusX:
+                updateLink(structure, nBlock.linkIndices().plusX, nBlock, source, direction.opposite());
+                break;
+            case Direction::Id::minusY:
+                updateLink(structure, nBlock.linkIndices().plusY, nBlock, source, direction.opposite());
+                break;
+            case Direction::Id::minusZ:
+                updateLink(structure, nBlock.linkIndices().plusZ, nBlock, source, direction.opposite());
+                break;
+            }
+        }
+
+        void updateLink(SolverStructure& structure, LinkIndex linkId, BlockData const& localNode, BlockData const& otherNode, Direction direction) const {
+            Link const newLink = linkOf(localNode, otherNode, direction);
+            assert(structure.links().at(linkId).localNodeId() == newLink.localNodeId());
+            assert(structure.links().at(linkId).otherNodeId() == newLink.otherNodeId());
+            structure.setLinkConductivity(linkId, newLink.conductivity());
         }
 
         [[nodiscard]]
@@ -242,6 +403,8 @@ namespace gustave::core::scenes::cuboidGridScene::detail {
         utils::prop::Ptr<SceneData> scene_;
         std::shared_ptr<SolverStructure> solverStructure_;
         SolverIndices solverIndices_;
+        GroundLinkIndices groundLinkIndices_;
+        std::optional<NodeIndex> groundNodeIndex_;
 
         [[no_unique_address]]
         UserDataMember userData_;
@@ -0,0 +1,113 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/core/scenes/common/cSceneUserData.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/StructureData.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockView.hpp>
+#include <gustave/utils/ForwardIterator.hpp>
+
+namespace gustave::core::scenes::cuboidGridScene::structureReference {
+    namespace blockViews::detail {
+        template<cfg::cLibConfig auto libCfg_, common::cSceneUserData UD_>
+        class Enumerator {
+        private:
+            using StructureData = cuboidGridScene::detail::StructureData<libCfg_, UD_>;
+
+            using DataIterator = StructureData::SolverIndices::ConstIterator;
+        public:
+            using Value = cuboidGridScene::BlockView<libCfg_, UD_>;
+
+            [[nodiscard]]
+            Enumerator()
+                : structureData_{ nullptr }
+                , dataIterator_{}
+            {}
+
+            [[nodiscard]]
+            explicit Enumerator(StructureData const& structureData)
+                : structureData_{ &structureData }
+                , dataIterator_{ structureData.solverIndices().begin() }
+            {}
+
+            [[nodiscard]]
+            bool isEnd() const {
+                return dataIterator_ == structureData_->solverIndices().end();
+            }
+
+            void operator++() {
+                ++dataIterator_;
+            }
+
+            [[nodiscard]]
+            Value operator*() const {
+                return Value{ structureData_->sceneData().blocks.at(dataIterator_->first) };
+            }
+
+            [[nodiscard]]
+            bool operator==(Enumerator const& other) const {
+                return dataIterator_ == other.dataIterator_;
+            }
+        private:
+            StructureData const* structureData_;
+            DataIterator dataIterator_;
+        };
+    }
+
+    template<cfg::cLibConfig auto libCfg_, common::cSceneUserData UD_>
+    class BlockViews {
+    private:
+        using StructureData = cuboidGridScene::detail::StructureData<libCfg_, UD_>;
+    public:
+        using BlockView = cuboidGridScene::BlockView<libCfg_, UD_>;
+        using Iterator = utils::ForwardIterator<blockViews::detail::Enumerator<libCfg_, UD_>>;
+
+        [[nodiscard]]
+        explicit BlockViews(StructureData const& data)
+            : data_{ &data }
+        {}
+
+        [[nodiscard]]
+        Iterator begin() const {
+            return Iterator{ *data_ };
+        }
+
+        [[nodiscard]]
+        constexpr std::default_sentinel_t end() const {
+            return {};
+        }
+
+        [[nodiscard]]
+        std::size_t size() const {
+            return data_->solverIndices().size();
+        }
+    private:
+        StructureData const* data_;
+    };
+}
@@ -92,6 +92,9 @@ namespace gustave::core::scenes::cuboidGridScene::structureReference {
                         if ((structId == srcBlockPtr->structureId()) || (structId == otherBlockPtr->structureId())) {
                             return result;
                         }
+                    } else if (result.isValid() && structId == srcBlockPtr->structureId()) {
+                        // Ground contact.
+                        return result;
                     }
                 }
             }
@@ -0,0 +1,170 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/core/scenes/common/cSceneUserData.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/GroundLinks.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/InternalLinks.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/StructureData.hpp>
+#include <gustave/core/scenes/cuboidGridScene/ContactIndex.hpp>
+#include <gustave/core/scenes/cuboidGridScene/ContactView.hpp>
+#include <gustave/utils/ForwardIterator.hpp>
+#include <gustave/utils/NoInit.hpp>
+
+namespace gustave::core::scenes::cuboidGridScene::structureReference {
+    namespace linkViews::detail {
+        template<cfg::cLibConfig auto libCfg_, common::cSceneUserData UD_>
+        class Enumerator {
+        private:
+            using GroundLinks = cuboidGridScene::detail::GroundLinks<libCfg_, UD_>;
+            using InternalLinks = cuboidGridScene::detail::InternalLinks<libCfg_, UD_>;
+            using StructureData = cuboidGridScene::detail::StructureData<libCfg_, UD_>;
+
+            using Direction = GroundLinks::Direction;
+            using SolverIndexIterator = StructureData::SolverIndices::ConstIterator;
+        public:
+            using Value = cuboidGridScene::ContactView<libCfg_, UD_>;
+
+            Enumerator()
+                : structure_{ nullptr }
+                , solverIndexIt_{}
+                , internalLinks_{ utils::NO_INIT }
+                , groundLinks_{ utils::NO_INIT }
+                , linkIndex_{ 0 }
+            {}
+
+            explicit Enumerator(StructureData const& structure)
+                : structure_{ &structure }
+                , solverIndexIt_{ structure.solverIndices().begin() }
+                , internalLinks_{ utils::NO_INIT }
+                , groundLinks_{ utils::NO_INIT }
+                , linkIndex_{ 0 }
+            {
+                if (!isEnd()) {
+                    updateBlockLinks();
+                    next();
+                }
+            }
+
+            void operator++() {
+                ++linkIndex_;
+                next();
+            }
+
+            [[nodiscard]]
+            Value operator*() const {
+                auto const index = ContactIndex{ solverIndexIt_->first, direction() };
+                if (linkIndex_ < internalLinks_.size()) {
+                    return Value{ *structure_, internalLinks_.source(), internalLinks_[linkIndex_].otherBlock(), index };
+                }
+                return Value{ *structure_, internalLinks_.source(), index };
+            }
+
+            [[nodiscard]]
+            bool isEnd() const {
+                return solverIndexIt_ == structure_->solverIndices().end();
+            }
+
+            [[nodiscard]]
+            bool operator==(Enumerator const& other) const {
+                return (solverIndexIt_ == other.solverIndexIt_) && (linkIndex_ == other.linkIndex_);
+            }
+        private:
+            [[nodiscard]]
+            Direction direction() const {
+                if (linkIndex_ < internalLinks_.size()) {
+                    return internalLinks_[linkIndex_].direction();
+                }
+                return groundLinks_[linkIndex_ - internalLinks_.size()];
+            }
+
+            void next() {
+                auto const structId = structure_->index();
+                while (true) {
+                    auto const& srcBlock = internalLinks_.source();
+                    while (linkIndex_ < internalLinks_.size()) {
+                        auto const& nBlock = internalLinks_[linkIndex_].otherBlock();
+                        if ((structId == srcBlock.structureId()) || (structId == nBlock.structureId())) {
+                            return;
+                        }
+                        ++linkIndex_;
+                    }
+                    if (linkIndex_ < internalLinks_.size() + groundLinks_.size()) {
+                        return;
+                    }
+                    ++solverIndexIt_;
+                    if (!isEnd()) {
+                        updateBlockLinks();
+                        linkIndex_ = 0;
+                    } else {
+                        return;
+                    }
+                }
+            }
+
+            void updateBlockLinks() {
+                internalLinks_ = InternalLinks{ structure_->sceneData(), solverIndexIt_->first };
+                groundLinks_ = GroundLinks{ structure_->sceneData(), internalLinks_.source() };
+            }
+
+            StructureData const* structure_;
+            SolverIndexIterator solverIndexIt_;
+            InternalLinks internalLinks_;
+            GroundLinks groundLinks_;
+            std::size_t linkIndex_;
+        };
+    }
+
+    // Same contacts as Links, as ContactView.
+    template<cfg::cLibConfig auto libCfg_, common::cSceneUserData UD_>
+    class LinkViews {
+    private:
+        using StructureData = cuboidGridScene::detail::StructureData<libCfg_, UD_>;
+    public:
+        using ContactView = cuboidGridScene::ContactView<libCfg_, UD_>;
+        using Iterator = utils::ForwardIterator<linkViews::detail::Enumerator<libCfg_, UD_>>;
+
+        [[nodiscard]]
+        explicit LinkViews(StructureData const& structure)
+            : structure_{ &structure }
+        {}
+
+        [[nodiscard]]
+        Iterator begin() const {
+            return Iterator{ *structure_ };
+        }
+
+        [[nodiscard]]
+        constexpr std::default_sentinel_t end() const {
+            return {};
+        }
+    private:
+        StructureData const* structure_;
+    };
+}
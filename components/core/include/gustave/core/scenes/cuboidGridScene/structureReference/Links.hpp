@@ -32,6 +32,7 @@
 #include <gustave/cfg/LibTraits.hpp>
 #include <gustave/core/scenes/common/cSceneUserData.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/DataNeighbours.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/GroundLinks.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/InternalLinks.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/StructureData.hpp>
 #include <gustave/core/scenes/cuboidGridScene/ContactReference.hpp>
@@ -49,10 +50,12 @@ namespace gustave::core::scenes::cuboidGridScene::structureReference {
             template<typename T>
             using Prop = utils::Prop<isMut_, T>;
 
+            using GroundLinks = cuboidGridScene::detail::GroundLinks<libCfg_, UD_>;
             using InternalLinks = cuboidGridScene::detail::InternalLinks<libCfg_, UD_>;
             using StructureData = cuboidGridScene::detail::StructureData<libCfg_, UD_>;
 
-            using SolverIndexIterator = StructureData::SolverIndices::const_iterator;
+            using Direction = GroundLinks::Direction;
+            using SolverIndexIterator = StructureData::SolverIndices::ConstIterator;
         public:
             using Value = ContactReference<libCfg_, UD_, isMut_>;
 
@@ -60,6 +63,7 @@ namespace gustave::core::scenes::cuboidGridScene::structureReference {
                 : structure_{ nullptr }
                 , solverIndexIt_{}
                 , internalLinks_{ utils::NO_INIT }
+                , groundLinks_{ utils::NO_INIT }
                 , linkIndex_{ 0 }
             {}
 
@@ -67,10 +71,11 @@ namespace gustave::core::scenes::cuboidGridScene::structureReference {
                 : structure_{ &structure }
                 , solverIndexIt_{ structure.solverIndices().begin() }
                 , internalLinks_{ utils::NO_INIT }
+                , groundLinks_{ utils::NO_INIT }
                 , linkIndex_{ 0 }
             {
                 if (!isEnd()) {
-                    updateInternalLinks();
+                    updateBlockLinks();
                     next();
                 }
             }
@@ -82,8 +87,7 @@ namespace gustave::core::scenes::cuboidGridScene::structureReference {
 
             [[nodiscard]]
             Value operator*() const {
-                auto const index = ContactIndex{ solverIndexIt_->first, internalLinks_[linkIndex_].direction() };
-                return Value{ structure_->sceneData(), index };
+                return Value{ structure_->sceneData(), ContactIndex{ solverIndexIt_->first, direction() } };
             }
 
             [[nodiscard]]
@@ -96,6 +100,14 @@ namespace gustave::core::scenes::cuboidGridScene::structureReference {
                 return (solverIndexIt_ == other.solverIndexIt_) && (linkIndex_ == other.linkIndex_);
             }
         private:
+            [[nodiscard]]
+            Direction direction() const {
+                if (linkIndex_ < internalLinks_.size()) {
+                    return internalLinks_[linkIndex_].direction();
+                }
+                return groundLinks_[linkIndex_ - internalLinks_.size()];
+            }
+
             void next() {
                 auto const structId = structure_->index();
                 while (true) {
@@ -107,9 +119,12 @@ namespace gustave::core::scenes::cuboidGridScene::structureReference {
                         }
                         ++linkIndex_;
                     }
+                    if (linkIndex_ < internalLinks_.size() + groundLinks_.size()) {
+                        return;
+                    }
                     ++solverIndexIt_;
                     if (!isEnd()) {
-                        updateInternalLinks();
+                        updateBlockLinks();
                         linkIndex_ = 0;
                     } else {
                         return;
@@ -117,13 +132,15 @@ namespace gustave::core::scenes::cuboidGridScene::structureReference {
                 }
             }
 
-            void updateInternalLinks() {
+            void updateBlockLinks() {
                 internalLinks_ = InternalLinks{ structure_->sceneData(), solverIndexIt_->first };
+                groundLinks_ = GroundLinks{ structure_->sceneData(), internalLinks_.source() };
             }
 
             Prop<StructureData>* structure_;
             SolverIndexIterator solverIndexIt_;
             InternalLinks internalLinks_;
+            GroundLinks groundLinks_;
             std::size_t linkIndex_;
         };
     }
@@ -27,21 +27,39 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/cfg/cUnitOf.hpp>
 #include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/model/Stress.hpp>
 #include <gustave/core/solvers/force1Solver/detail/BasicStepRunner.hpp>
+#include <gustave/core/solvers/force1Solver/detail/BatchRunContext.hpp>
+#include <gustave/core/solvers/force1Solver/detail/BatchStepRunner.hpp>
 #include <gustave/core/solvers/force1Solver/detail/ClusterStepRunner.hpp>
 #include <gustave/core/solvers/force1Solver/detail/LayerStepRunner.hpp>
+#include <gustave/core/solvers/force1Solver/detail/LowPrecisionRunner.hpp>
 #include <gustave/core/solvers/force1Solver/detail/SolverRunContext.hpp>
+#include <gustave/core/solvers/force1Solver/detail/StabilityEvaluator.hpp>
+#include <gustave/core/solvers/force1Solver/detail/SubdomainStepRunner.hpp>
 #include <gustave/core/solvers/force1Solver/Config.hpp>
+#include <gustave/core/solvers/force1Solver/Decomposition.hpp>
+#include <gustave/core/solvers/force1Solver/LoadCase.hpp>
 #include <gustave/core/solvers/force1Solver/Solution.hpp>
+#include <gustave/core/solvers/force1Solver/StabilityResult.hpp>
 #include <gustave/core/solvers/Structure.hpp>
+#include <gustave/utils/cExecutor.hpp>
+#include <gustave/utils/SerialExecutor.hpp>
 
 namespace gustave::core::solvers {
     template<cfg::cLibConfig auto libCfg>
@@ -60,29 +78,53 @@ namespace gustave::core::solvers {
         using NormalizedVector3 = cfg::NormalizedVector3<libCfg>;
 
         using BasicStepRunner = force1Solver::detail::BasicStepRunner<libCfg>;
+        using BatchRunContext = force1Solver::detail::BatchRunContext<libCfg>;
+        using BatchStepRunner = force1Solver::detail::BatchStepRunner<libCfg>;
         using ClusterStepRunner = force1Solver::detail::ClusterStepRunner<libCfg>;
         using LayerStepRunner = force1Solver::detail::LayerStepRunner<libCfg>;
         using SolverRunContext = force1Solver::detail::SolverRunContext<libCfg>;
+        using StabilityEvaluator = force1Solver::detail::StabilityEvaluator<libCfg>;
+        using SubdomainStepRunner = force1Solver::detail::SubdomainStepRunner<libCfg>;
 
         using BasicStepResult = BasicStepRunner::StepResult;
         using F1Structure = SolverRunContext::F1Structure;
+
+        using LowRealRep = float;
     public:
         using Config = force1Solver::Config<libCfg>;
+        using Decomposition = force1Solver::Decomposition<libCfg>;
+        using ForceStress = model::ForceStress<libCfg>;
+        using LoadCase = force1Solver::LoadCase<libCfg>;
         using Solution = force1Solver::Solution<libCfg>;
+        using StabilityResult = force1Solver::StabilityResult<libCfg>;
         using Structure = solvers::Structure<libCfg>;
 
         using Basis = Solution::Basis;
         using IterationIndex = SolverRunContext::IterationIndex;
+        using LinkStability = StabilityResult::LinkStability;
         using Node = Structure::Node;
 
+        static constexpr IterationIndex stabilityCheckPeriod = 4;
+
+        static constexpr bool hasMixedPrecision = !std::is_same_v<typename decltype(libCfg)::RealRep, LowRealRep>
+            && cfg::cLibConfigWithRealRep<decltype(libCfg), LowRealRep>;
+
         class Result {
         public:
             [[nodiscard]]
-            Result(IterationIndex iterations, std::shared_ptr<Solution const> solution)
+            Result(IterationIndex iterations, std::shared_ptr<Solution const> solution, std::shared_ptr<Decomposition const> decomposition = nullptr)
                 : iterations_{ iterations }
                 , solution_{ solution }
+                , decomposition_{ std::move(decomposition) }
             {}
 
+            // Decomposition of the structure, reusable by a later run on it after its masses or conductivities changed.
+            // nullptr if the structure is unsolvable, and for runBatch() results.
+            [[nodiscard]]
+            std::shared_ptr<Decomposition const> const& decompositionPtr() const {
+                return decomposition_;
+            }
+
             [[nodiscard]]
             bool isSolved() const {
                 return solution_ != nullptr;
@@ -108,6 +150,7 @@ namespace gustave::core::solvers {
         private:
             IterationIndex iterations_;
             std::shared_ptr<Solution const> solution_;
+            std::shared_ptr<Decomposition const> decomposition_;
         };
 
         [[nodiscard]]
@@ -124,32 +167,256 @@ namespace gustave::core::solvers {
 
         [[nodiscard]]
         Result run(std::shared_ptr<Structure const> structure) const {
+            utils::SerialExecutor executor;
+            return run(std::move(structure), executor);
+        }
+
+        [[nodiscard]]
+        Result run(std::shared_ptr<Structure const> structure, utils::cExecutor auto& executor) const {
+            return runFrom(std::move(structure), {}, nullptr, executor);
+        }
+
+        // Warm start: iterations begin from the potentials of initialGuess (usually the solution of the same
+        // structure before its masses or conductivities were changed) instead of zero.
+        [[nodiscard]]
+        Result run(std::shared_ptr<Structure const> structure, Solution const& initialGuess) const {
+            utils::SerialExecutor executor;
+            return run(std::move(structure), initialGuess, executor);
+        }
+
+        [[nodiscard]]
+        Result run(std::shared_ptr<Structure const> structure, Solution const& initialGuess, utils::cExecutor auto& executor) const {
+            return run(std::move(structure), initialGuess.basis(), executor);
+        }
+
+        // Warm start from the potentials of a basis, without needing the rest of its solution.
+        [[nodiscard]]
+        Result run(std::shared_ptr<Structure const> structure, Basis const& initialGuess) const {
+            utils::SerialExecutor executor;
+            return run(std::move(structure), initialGuess, executor);
+        }
+
+        [[nodiscard]]
+        Result run(std::shared_ptr<Structure const> structure, Basis const& initialGuess, utils::cExecutor auto& executor) const {
+            checkInitialGuess(structure.get(), initialGuess);
+            return runFrom(std::move(structure), initialGuess.potentials(), nullptr, executor);
+        }
+
+        // Warm start also reusing the decomposition of a previous run (Result::decompositionPtr()) on a structure
+        // of the same topology: only its masses or conductivities may have changed.
+        [[nodiscard]]
+        Result run(std::shared_ptr<Structure const> structure, Basis const& initialGuess, Decomposition const& decomposition) const {
+            utils::SerialExecutor executor;
+            return run(std::move(structure), initialGuess, decomposition, executor);
+        }
+
+        [[nodiscard]]
+        Result run(std::shared_ptr<Structure const> structure, Basis const& initialGuess, Decomposition const& decomposition, utils::cExecutor auto& executor) const {
+            checkInitialGuess(structure.get(), initialGuess);
+            if (structure != nullptr && !decomposition.isCompatibleWith(*structure)) {
+                throw std::invalid_argument("The decomposition doesn't match the topology of the structure.");
+            }
+            return runFrom(std::move(structure), initialGuess.potentials(), &decomposition, executor);
+        }
+
+        [[nodiscard]]
+        std::vector<Result> runBatch(std::shared_ptr<Structure const> structure, std::span<LoadCase const> loadCases) const {
+            utils::SerialExecutor executor;
+            return runBatch(std::move(structure), loadCases, executor);
+        }
+
+        // Groups of load cases sharing the direction of g are solved together; distinct groups run in parallel on the executor.
+        [[nodiscard]]
+        std::vector<Result> runBatch(std::shared_ptr<Structure const> structure, std::span<LoadCase const> loadCases, utils::cExecutor auto& executor) const {
+            if (structure == nullptr) {
+                throw std::logic_error("Unexpected null pointer for argument 'structure'.");
+            }
+            for (LoadCase const& loadCase : loadCases) {
+                if (loadCase.hasExtraMasses() && loadCase.extraMasses().size() != structure->nodes().size()) {
+                    std::stringstream msg;
+                    msg << "Expected " << structure->nodes().size() << " extra masses (one per node), got " << loadCase.extraMasses().size() << '.';
+                    throw std::invalid_argument(msg.str());
+                }
+            }
+            std::vector<Result> results(loadCases.size(), Result{ 0, nullptr });
+            std::vector<bool> isCaseGrouped(loadCases.size(), false);
+            std::vector<std::vector<LoadCase const*>> groups;
+            std::vector<std::vector<std::size_t>> groupIds;
+            for (std::size_t firstId = 0; firstId < loadCases.size(); ++firstId) {
+                if (isCaseGrouped[firstId]) {
+                    continue;
+                }
+                NormalizedVector3 const direction{ loadCases[firstId].g() };
+                auto& group = groups.emplace_back();
+                auto& ids = groupIds.emplace_back();
+                for (std::size_t caseId = firstId; caseId < loadCases.size(); ++caseId) {
+                    if (!isCaseGrouped[caseId] && NormalizedVector3{ loadCases[caseId].g() } == direction) {
+                        isCaseGrouped[caseId] = true;
+                        ids.push_back(caseId);
+                        group.push_back(&loadCases[caseId]);
+                    }
+                }
+            }
+            executor.parallelFor(groups.size(), [&](std::size_t groupId) {
+                runBatchGroup(structure, groups[groupId], groupIds[groupId], results);
+            });
+            return results;
+        }
+
+        [[nodiscard]]
+        StabilityResult checkStability(Structure const& structure, std::span<ForceStress const> maxForceStresses) const {
+            utils::SerialExecutor executor;
+            return checkStability(structure, maxForceStresses, executor);
+        }
+
+        [[nodiscard]]
+        StabilityResult checkStability(Structure const& structure, std::span<ForceStress const> maxForceStresses, utils::cExecutor auto& executor) const {
+            if (maxForceStresses.size() != structure.links().size()) {
+                std::stringstream msg;
+                msg << "Expected " << structure.links().size() << " max force stresses (one per link), got " << maxForceStresses.size() << '.';
+                throw std::invalid_argument(msg.str());
+            }
+            SolverRunContext ctx{ structure, *config_ };
+            std::vector<LinkStability> links;
+            links.reserve(structure.links().size());
+            if (!isSolvable(ctx)) {
+                auto const zero = 0.f * u.one;
+                auto const inf = std::numeric_limits<typename decltype(libCfg)::RealRep>::infinity() * u.one;
+                for (std::size_t linkId = 0; linkId < structure.links().size(); ++linkId) {
+                    links.emplace_back(typename LinkStability::StressRatio{ zero, zero, zero }, typename LinkStability::StressRatio{ inf, inf, inf });
+                }
+                return StabilityResult{ ctx.iterationIndex, std::move(links) };
+            }
+            auto const evaluator = StabilityEvaluator{ ctx, maxForceStresses };
+            BasicStepRunner basicRunner{ ctx };
+            ClusterStepRunner clusterRunner{ ctx };
+            LayerStepRunner layerRunner{ ctx };
+            auto subdomainRunner = makeSubdomainRunner(ctx);
+            for (IterationIndex stepId = 1; true; ++stepId) {
+                layerRunner.runStep(executor);
+                for (auto const& cStructure : ctx.cStructures) {
+                    clusterRunner.runStep(cStructure, executor);
+                }
+                if (subdomainRunner) {
+                    subdomainRunner->runStep(executor);
+                }
+                BasicStepResult const stepResult = basicRunner.runStep(executor);
+                bool const isLastStep = stepResult.isBelowTargetError || (ctx.iterationIndex >= config_->maxIterations());
+                if (isLastStep || (stepId % stabilityCheckPeriod == 0)) {
+                    if (evaluator.evaluate(links) || isLastStep) {
+                        return StabilityResult{ ctx.iterationIndex, std::move(links) };
+                    }
+                }
+            }
+        }
+    private:
+        [[nodiscard]]
+        static bool isSolvable(SolverRunContext const& ctx) {
+            return ctx.lStructure.reachedCount() == ctx.fStructure.fNodes().size();
+        }
+
+        // decomposition: nullable. Its subdomains are reused if they have the configured size.
+        [[nodiscard]]
+        std::optional<SubdomainStepRunner> makeSubdomainRunner(SolverRunContext& ctx, Decomposition const* decomposition = nullptr) const {
+            std::optional<SubdomainStepRunner> result;
+            std::size_t const subdomainSize = config_->subdomainSize();
+            if (subdomainSize > 0) {
+                if (decomposition != nullptr && decomposition->subdomains() != nullptr && decomposition->subdomainSize() == subdomainSize) {
+                    result.emplace(ctx, decomposition->subdomains());
+                } else {
+                    result.emplace(ctx, subdomainSize);
+                }
+            }
+            return result;
+        }
+
+        static void checkInitialGuess(Structure const* structure, Basis const& initialGuess) {
+            auto const& potentials = initialGuess.potentials();
+            if (structure != nullptr && potentials.size() != structure->nodes().size()) {
+                std::stringstream msg;
+                msg << "Expected an initial guess with " << structure->nodes().size() << " nodes, got " << potentials.size() << '.';
+                throw std::invalid_argument(msg.str());
+            }
+        }
+
+        // decomposition: nullable. If set, reused instead of decomposing the structure.
+        [[nodiscard]]
+        Result runFrom(std::shared_ptr<Structure const> structure, std::span<Real<u.potential> const> initialPotentials,
+            Decomposition const* decomposition, utils::cExecutor auto& executor) const
+        {
             if (structure == nullptr) {
                 throw std::logic_error("Unexpected null pointer for argument 'structure'.");
             }
-            SolverRunContext ctx{ *structure, *config_ };
+            SolverRunContext ctx = (decomposition != nullptr)
+                ? SolverRunContext{ *structure, *config_, *decomposition }
+                : SolverRunContext{ *structure, *config_ };
             if (!isSolvable(ctx)) {
                 return makeInvalidResult(std::move(ctx));
             }
+            if (!initialPotentials.empty()) {
+                ctx.potentials = ctx.fStructure.fPotentialsOf(initialPotentials);
+            } else if constexpr (hasMixedPrecision) {
+                if (config_->mixedPrecision()) {
+                    using LowPrecisionRunner = force1Solver::detail::LowPrecisionRunner<libCfg, cfg::withRealRep<libCfg, LowRealRep>>;
+                    LowPrecisionRunner{ ctx }.run(executor);
+                }
+            }
             BasicStepRunner basicRunner{ ctx };
             ClusterStepRunner clusterRunner{ ctx };
             LayerStepRunner layerRunner{ ctx };
+            auto subdomainRunner = makeSubdomainRunner(ctx, decomposition);
             do {
-                layerRunner.runStep();
+                layerRunner.runStep(executor);
                 for (auto const& cStructure : ctx.cStructures) {
-                    clusterRunner.runStep(cStructure);
+                    clusterRunner.runStep(cStructure, executor);
+                }
+                if (subdomainRunner) {
+                    subdomainRunner->runStep(executor);
                 }
-                BasicStepResult const stepResult = basicRunner.runStep();
+                BasicStepResult const stepResult = basicRunner.runStep(executor);
                 if (stepResult.isBelowTargetError) {
-                    return makeValidResult(std::move(ctx), std::move(structure));
+                    auto newDecomposition = makeDecomposition(ctx, *structure, subdomainRunner);
+                    return makeValidResult(std::move(ctx), std::move(structure), std::move(newDecomposition));
                 }
             } while (ctx.iterationIndex < config_->maxIterations());
-            return makeInvalidResult(std::move(ctx));
+            auto newDecomposition = makeDecomposition(ctx, *structure, subdomainRunner);
+            return Result{ ctx.iterationIndex, nullptr, std::move(newDecomposition) };
         }
-    private:
+
+        void runBatchGroup(std::shared_ptr<Structure const> const& structure, std::span<LoadCase const* const> group,
+            std::span<std::size_t const> resultIds, std::vector<Result>& results) const
+        {
+            Config const groupConfig = configOf(*group[0]);
+            BatchRunContext ctx{ *structure, groupConfig, group };
+            if (ctx.lStructure.reachedCount() != ctx.fStructure.fNodes().size()) {
+                return;
+            }
+            BatchStepRunner runner{ ctx };
+            do {
+                runner.runLayerStep();
+                for (std::size_t cStructureId = 0; cStructureId < ctx.cStructures.size(); ++cStructureId) {
+                    runner.runClusterStep(cStructureId);
+                }
+                if (runner.runBasicStep().isBelowTargetError) {
+                    for (std::size_t caseId = 0; caseId < group.size(); ++caseId) {
+                        LoadCase const& loadCase = *group[caseId];
+                        auto caseConfig = std::make_shared<Config const>(configOf(loadCase));
+                        auto basis = std::make_shared<Basis const>(structure, std::move(caseConfig), ctx.potentialsOfCase(caseId), loadCase.extraMasses());
+                        results[resultIds[caseId]] = Result{ ctx.iterationIndex, std::make_shared<Solution const>(std::move(basis)) };
+                    }
+                    return;
+                }
+            } while (ctx.iterationIndex < config_->maxIterations());
+            for (std::size_t resultId : resultIds) {
+                results[resultId] = Result{ ctx.iterationIndex, nullptr };
+            }
+        }
+
         [[nodiscard]]
-        static bool isSolvable(SolverRunContext const& ctx) {
-            return ctx.lStructure.reachedCount() == ctx.fStructure.fNodes().size();
+        Config configOf(LoadCase const& loadCase) const {
+            Config result = *config_;
+            result.setG(loadCase.g());
+            return result;
         }
 
         [[nodiscard]]
@@ -157,10 +424,24 @@ namespace gustave::core::solvers {
             return Result{ ctx.iterationIndex, nullptr };
         }
 
+        // Moves the layer & cluster structures out of ctx.
+        [[nodiscard]]
+        static std::shared_ptr<Decomposition const> makeDecomposition(SolverRunContext& ctx, Structure const& structure,
+            std::optional<SubdomainStepRunner> const& subdomainRunner)
+        {
+            std::shared_ptr<typename Decomposition::SubdomainDecomposition const> subdomains = nullptr;
+            std::size_t subdomainSize = 0;
+            if (subdomainRunner) {
+                subdomains = subdomainRunner->decompositionPtr();
+                subdomainSize = ctx.config().subdomainSize();
+            }
+            return std::make_shared<Decomposition const>(structure, std::move(ctx.lStructure), std::move(ctx.cStructures), std::move(subdomains), subdomainSize);
+        }
+
         [[nodiscard]]
-        Result makeValidResult(SolverRunContext&& ctx, std::shared_ptr<Structure const>&& structure) const {
-            auto basis = std::make_shared<Basis const>(std::move(structure), config_, std::move(ctx.potentials));
-            return Result{ ctx.iterationIndex, std::make_shared<Solution const>(std::move(basis), std::move(ctx.fStructure)) };
+        Result makeValidResult(SolverRunContext&& ctx, std::shared_ptr<Structure const>&& structure, std::shared_ptr<Decomposition const>&& decomposition) const {
+            auto basis = std::make_shared<Basis const>(std::move(structure), config_, ctx.fStructure.potentialsOf(ctx.potentials));
+            return Result{ ctx.iterationIndex, std::make_shared<Solution const>(std::move(basis), std::move(ctx.fStructure)), std::move(decomposition) };
         }
 
         std::shared_ptr<Config const> config_;
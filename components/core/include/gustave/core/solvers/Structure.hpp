@@ -25,9 +25,13 @@
 
 #pragma once
 
+#include <cassert>
+#include <stdexcept>
 #include <vector>
 
 #include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
 #include <gustave/core/solvers/structure/ContactIndex.hpp>
 #include <gustave/core/solvers/structure/Link.hpp>
 #include <gustave/core/solvers/structure/Node.hpp>
@@ -36,11 +40,17 @@
 namespace gustave::core::solvers {
     template<cfg::cLibConfig auto libCfg>
     class Structure {
+    private:
+        static constexpr auto u = cfg::units(libCfg);
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
     public:
         using ContactIndex = structure::ContactIndex<libCfg>;
         using Link = structure::Link<libCfg>;
         using Node = structure::Node<libCfg>;
 
+        using Conductivity = Link::Conductivity;
         using LinkIndex = Link::LinkIndex;
         using NodeIndex = Node::NodeIndex;
 
@@ -63,7 +73,7 @@ namespace gustave::core::solvers {
                 throw std::overflow_error("Maximum number of nodes allowed by library configuration reached.");
             }
             nodes_.push_back(newNode);
-            return result;
+            return static_cast<NodeIndex>(result);
         }
 
         LinkIndex addLink(Link const& newLink) {
@@ -74,7 +84,17 @@ namespace gustave::core::solvers {
             assert(newLink.localNodeId() < nodes_.size());
             assert(newLink.otherNodeId() < nodes_.size());
             links_.push_back(newLink);
-            return result;
+            return static_cast<LinkIndex>(result);
+        }
+
+        void setLinkConductivity(LinkIndex linkId, Conductivity const& conductivity) {
+            Link const& link = links_.at(linkId);
+            links_[linkId] = Link{ link.localNodeId(), link.otherNodeId(), link.normal(), conductivity };
+        }
+
+        void setNodeMass(NodeIndex nodeId, Real<u.mass> mass) {
+            Node const& node = nodes_.at(nodeId);
+            nodes_[nodeId] = Node{ mass, node.isFoundation };
         }
     private:
         Nodes nodes_;
@@ -25,6 +25,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/cfg/cUnitOf.hpp>
 #include <gustave/cfg/LibTraits.hpp>
@@ -48,10 +50,24 @@ namespace gustave::core::solvers::force1Solver {
             : g_{ g }
             , maxIterations_{ maxIterations }
             , targetMaxError_{ targetMaxError }
+            , mixedPrecision_{ false }
+            , subdomainSize_{ 0 }
+            , compactSolutions_{ false }
         {
             setTargetMaxError(targetMaxError); // check value correctness
         }
 
+        // Solutions keep one precomputed force per link instead of the solver's internal structure: several times smaller,
+        // but they ignore later changes to the potentials of their basis.
+        [[nodiscard]]
+        bool compactSolutions() const {
+            return compactSolutions_;
+        }
+
+        void setCompactSolutions(bool newValue) {
+            compactSolutions_ = newValue;
+        }
+
         [[nodiscard]]
         Vector3<u.acceleration> const& g() const {
             return g_;
@@ -70,6 +86,25 @@ namespace gustave::core::solvers::force1Solver {
             maxIterations_ = newValue;
         }
 
+        [[nodiscard]]
+        bool mixedPrecision() const {
+            return mixedPrecision_;
+        }
+
+        void setMixedPrecision(bool newValue) {
+            mixedPrecision_ = newValue;
+        }
+
+        // Maximum node count of a subdomain in the domain-decomposition steps (0: disabled).
+        [[nodiscard]]
+        std::size_t subdomainSize() const {
+            return subdomainSize_;
+        }
+
+        void setSubdomainSize(std::size_t newValue) {
+            subdomainSize_ = newValue;
+        }
+
         [[nodiscard]]
         Real<u.one> targetMaxError() const {
             return targetMaxError_;
@@ -87,5 +122,8 @@ namespace gustave::core::solvers::force1Solver {
         Vector3<u.acceleration> g_;
         IterationIndex maxIterations_;
         Real<u.one> targetMaxError_;
+        bool mixedPrecision_;
+        std::size_t subdomainSize_;
+        bool compactSolutions_;
     };
 }
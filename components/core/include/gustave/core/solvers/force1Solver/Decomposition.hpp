@@ -0,0 +1,118 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/solvers/force1Solver/detail/ClusterStructure.hpp>
+#include <gustave/core/solvers/force1Solver/detail/LayerStructure.hpp>
+#include <gustave/core/solvers/force1Solver/detail/SubdomainDecomposition.hpp>
+#include <gustave/core/solvers/Structure.hpp>
+
+namespace gustave::core::solvers::force1Solver {
+    // Partitions of the nodes of a structure computed by a solver run. They depend only on its topology
+    // (nodes, foundations and links): a later run on the same structure with new masses or conductivities
+    // can reuse them instead of decomposing it again.
+    template<cfg::cLibConfig auto libCfg>
+    class Decomposition {
+    public:
+        using ClusterStructure = detail::ClusterStructure<libCfg>;
+        using LayerStructure = detail::LayerStructure<libCfg>;
+        using Structure = solvers::Structure<libCfg>;
+        using SubdomainDecomposition = detail::SubdomainDecomposition<libCfg>;
+
+        // subdomains: nullptr if the run used no subdomains (subdomainSize == 0).
+        [[nodiscard]]
+        explicit Decomposition(Structure const& structure, LayerStructure layers, std::vector<ClusterStructure> clusters,
+            std::shared_ptr<SubdomainDecomposition const> subdomains, std::size_t subdomainSize)
+            : layers_{ std::move(layers) }
+            , clusters_{ std::move(clusters) }
+            , subdomains_{ std::move(subdomains) }
+            , subdomainSize_{ subdomainSize }
+            , nodeCount_{ structure.nodes().size() }
+            , linkCount_{ structure.links().size() }
+        {}
+
+        [[nodiscard]]
+        std::vector<ClusterStructure> const& clusters() const {
+            return clusters_;
+        }
+
+        // True if this decomposition can be reused for a run on structure. Only node & link counts are compared:
+        // the caller guarantees that the topology is otherwise unchanged.
+        [[nodiscard]]
+        bool isCompatibleWith(Structure const& structure) const {
+            return structure.nodes().size() == nodeCount_ && structure.links().size() == linkCount_;
+        }
+
+        [[nodiscard]]
+        LayerStructure const& layers() const {
+            return layers_;
+        }
+
+        // Bytes used by this decomposition.
+        [[nodiscard]]
+        std::size_t memoryUsage() const {
+            std::size_t result = sizeof(*this) + layers_.memoryUsage() + clusters_.capacity() * sizeof(ClusterStructure);
+            for (auto const& cluster : clusters_) {
+                result += cluster.memoryUsage();
+            }
+            if (subdomains_ != nullptr) {
+                using NodeIndex = SubdomainDecomposition::NodeIndex;
+                using SubdomainIndex = SubdomainDecomposition::SubdomainIndex;
+                result += sizeof(SubdomainDecomposition)
+                    + subdomains_->subdomainOfNode.capacity() * sizeof(SubdomainIndex)
+                    + subdomains_->subdomains.capacity() * sizeof(std::vector<NodeIndex>);
+                for (auto const& subdomain : subdomains_->subdomains) {
+                    result += subdomain.capacity() * sizeof(NodeIndex);
+                }
+            }
+            return result;
+        }
+
+        [[nodiscard]]
+        std::shared_ptr<SubdomainDecomposition const> const& subdomains() const {
+            return subdomains_;
+        }
+
+        [[nodiscard]]
+        std::size_t subdomainSize() const {
+            return subdomainSize_;
+        }
+    private:
+        LayerStructure layers_;
+        std::vector<ClusterStructure> clusters_;
+        std::shared_ptr<SubdomainDecomposition const> subdomains_;
+        std::size_t subdomainSize_;
+        std::size_t nodeCount_;
+        std::size_t linkCount_;
+    };
+}
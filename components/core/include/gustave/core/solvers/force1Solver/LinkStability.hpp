@@ -0,0 +1,88 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/model/Stress.hpp>
+#include <gustave/core/solvers/force1Solver/StabilityVerdict.hpp>
+
+namespace gustave::core::solvers::force1Solver {
+    template<cfg::cLibConfig auto libCfg>
+    class LinkStability {
+    private:
+        static constexpr auto u = cfg::units(libCfg);
+    public:
+        using StressRatio = model::StressRatio<libCfg>;
+        using Verdict = StabilityVerdict;
+
+        [[nodiscard]]
+        explicit LinkStability(StressRatio const& stressRatio, StressRatio const& errorBound)
+            : stressRatio_{ stressRatio }
+            , errorBound_{ errorBound }
+            , verdict_{ computeVerdict(stressRatio, errorBound) }
+        {}
+
+        [[nodiscard]]
+        StressRatio const& errorBound() const {
+            return errorBound_;
+        }
+
+        [[nodiscard]]
+        StressRatio const& stressRatio() const {
+            return stressRatio_;
+        }
+
+        [[nodiscard]]
+        Verdict verdict() const {
+            return verdict_;
+        }
+
+        [[nodiscard]]
+        bool operator==(LinkStability const&) const = default;
+    private:
+        [[nodiscard]]
+        static Verdict computeVerdict(StressRatio const& ratio, StressRatio const& bound) {
+            bool const isAbove = (ratio.compression() - bound.compression() > 1.f)
+                || (ratio.shear() - bound.shear() > 1.f)
+                || (ratio.tensile() - bound.tensile() > 1.f);
+            if (isAbove) {
+                return Verdict::Unstable;
+            }
+            bool const isBelow = (ratio.compression() + bound.compression() < 1.f)
+                && (ratio.shear() + bound.shear() < 1.f)
+                && (ratio.tensile() + bound.tensile() < 1.f);
+            if (isBelow) {
+                return Verdict::Stable;
+            }
+            return Verdict::Undecided;
+        }
+
+        StressRatio stressRatio_;
+        StressRatio errorBound_;
+        Verdict verdict_;
+    };
+}
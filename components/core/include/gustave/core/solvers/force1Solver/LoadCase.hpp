@@ -0,0 +1,76 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+
+namespace gustave::core::solvers::force1Solver {
+    template<cfg::cLibConfig auto libCfg>
+    class LoadCase {
+    private:
+        static constexpr auto u = cfg::units(libCfg);
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Vector3 = cfg::Vector3<libCfg, unit>;
+    public:
+        [[nodiscard]]
+        explicit LoadCase(Vector3<u.acceleration> const& g)
+            : g_{ g }
+        {}
+
+        [[nodiscard]]
+        explicit LoadCase(Vector3<u.acceleration> const& g, std::vector<Real<u.mass>> extraMasses)
+            : g_{ g }
+            , extraMasses_{ std::move(extraMasses) }
+        {}
+
+        [[nodiscard]]
+        std::vector<Real<u.mass>> const& extraMasses() const {
+            return extraMasses_;
+        }
+
+        [[nodiscard]]
+        Vector3<u.acceleration> const& g() const {
+            return g_;
+        }
+
+        [[nodiscard]]
+        bool hasExtraMasses() const {
+            return !extraMasses_.empty();
+        }
+    private:
+        Vector3<u.acceleration> g_;
+        std::vector<Real<u.mass>> extraMasses_;
+    };
+}
@@ -25,6 +25,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <utility>
 
 #include <gustave/cfg/cLibConfig.hpp>
@@ -81,9 +83,20 @@ namespace gustave::core::solvers::force1Solver {
             return data_.basis();
         }
 
+        [[nodiscard]]
+        std::shared_ptr<Basis const> const& basisPtr() const {
+            return data_.basisPtr();
+        }
+
+        // True if built with Config::compactSolutions().
+        [[nodiscard]]
+        bool isCompact() const {
+            return data_.isCompact();
+        }
+
         [[nodiscard]]
         Real<u.one> maxRelativeError() const {
-            return data_.forceRepartition().maxRelativeError();
+            return data_.maxRelativeError();
         }
 
         [[nodiscard]]
@@ -91,6 +104,12 @@ namespace gustave::core::solvers::force1Solver {
             return Contacts{ data_ };
         }
 
+        // Bytes used by this solution, excluding its (shared) basis.
+        [[nodiscard]]
+        std::size_t memoryUsage() const {
+            return sizeof(*this) + data_.memoryUsage();
+        }
+
         [[nodiscard]]
         Nodes nodes() const {
             return Nodes{ data_ };
@@ -51,6 +51,8 @@ namespace gustave::core::solvers::force1Solver {
         using Config = force1Solver::Config<libCfg>;
         using Structure = solvers::Structure<libCfg>;
 
+        using NodeIndex = Structure::NodeIndex;
+
         [[nodiscard]]
         explicit SolutionBasis(std::shared_ptr<Structure const> structure, std::shared_ptr<Config const> config)
             : config_{ std::move(config) }
@@ -72,11 +74,38 @@ namespace gustave::core::solvers::force1Solver {
             checkPotentials();
         }
 
+        // extraMasses: per-node masses added to the ones of the structure (load case overlay), or empty.
+        [[nodiscard]]
+        explicit SolutionBasis(std::shared_ptr<Structure const> structure, std::shared_ptr<Config const> config,
+            std::vector<Real<u.potential>> potentials, std::vector<Real<u.mass>> extraMasses)
+            : config_{ std::move(config) }
+            , structure_{ std::move(structure) }
+            , potentials_{ std::move(potentials) }
+            , extraMasses_{ std::move(extraMasses) }
+        {
+            assert(config_);
+            assert(structure_);
+            checkPotentials();
+            assert(extraMasses_.empty() || extraMasses_.size() == structure_->nodes().size());
+        }
+
         [[nodiscard]]
         Config const& config() const {
             return *config_;
         }
 
+        [[nodiscard]]
+        std::vector<Real<u.mass>> const& extraMasses() const {
+            return extraMasses_;
+        }
+
+        // Mass of a node of structure(), extra mass included.
+        [[nodiscard]]
+        Real<u.mass> massOf(NodeIndex nodeId) const {
+            Real<u.mass> const mass = structure_->nodes()[nodeId].mass();
+            return extraMasses_.empty() ? mass : mass + extraMasses_[nodeId];
+        }
+
         [[nodiscard]]
         Structure const& structure() const {
             return *structure_;
@@ -100,6 +129,7 @@ namespace gustave::core::solvers::force1Solver {
         std::shared_ptr<Config const> config_;
         std::shared_ptr<Structure const> structure_;
         std::vector<Real<u.potential>> potentials_;
+        std::vector<Real<u.mass>> extraMasses_;
 
         void checkPotentials() const {
             assert(potentials_.size() == structure_->nodes().size());
@@ -0,0 +1,73 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/core/solvers/force1Solver/LinkStability.hpp>
+
+namespace gustave::core::solvers::force1Solver {
+    template<cfg::cLibConfig auto libCfg>
+    class StabilityResult {
+    public:
+        using IterationIndex = std::uint64_t;
+        using LinkStability = force1Solver::LinkStability<libCfg>;
+        using Verdict = LinkStability::Verdict;
+
+        [[nodiscard]]
+        explicit StabilityResult(IterationIndex iterations, std::vector<LinkStability> links)
+            : iterations_{ iterations }
+            , links_{ std::move(links) }
+        {}
+
+        [[nodiscard]]
+        bool isDecided() const {
+            return std::ranges::none_of(links_, [](LinkStability const& link) { return link.verdict() == Verdict::Undecided; });
+        }
+
+        [[nodiscard]]
+        bool isStable() const {
+            return std::ranges::all_of(links_, [](LinkStability const& link) { return link.verdict() == Verdict::Stable; });
+        }
+
+        [[nodiscard]]
+        IterationIndex iterations() const {
+            return iterations_;
+        }
+
+        [[nodiscard]]
+        std::vector<LinkStability> const& links() const {
+            return links_;
+        }
+    private:
+        IterationIndex iterations_;
+        std::vector<LinkStability> links_;
+    };
+}
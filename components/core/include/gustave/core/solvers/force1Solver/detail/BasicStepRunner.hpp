@@ -25,12 +25,18 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/cfg/cUnitOf.hpp>
 #include <gustave/cfg/LibTraits.hpp>
 #include <gustave/core/solvers/force1Solver/detail/BasicNodeEvaluator.hpp>
 #include <gustave/core/solvers/force1Solver/detail/NodeBalancer.hpp>
 #include <gustave/core/solvers/force1Solver/detail/SolverRunContext.hpp>
+#include <gustave/utils/cExecutor.hpp>
+#include <gustave/utils/SerialExecutor.hpp>
 
 namespace gustave::core::solvers::force1Solver::detail {
     template<cfg::cLibConfig auto libCfg>
@@ -50,8 +56,11 @@ namespace gustave::core::solvers::force1Solver::detail {
         using NodeEvaluator = detail::BasicNodeEvaluator<libCfg>;
     public:
         static constexpr Real<u.one> targetErrorFactor = 0.75f;
+        // Number of nodes balanced by a single task of the executor.
+        static constexpr std::size_t chunkSize = 512;
 
         struct StepResult {
+            Real<u.one> maxError;
             bool isBelowTargetError;
         };
 
@@ -61,29 +70,46 @@ namespace gustave::core::solvers::force1Solver::detail {
         {}
 
         StepResult runStep() {
-            Real<u.one> currentMaxError = 0.f;
+            utils::SerialExecutor executor;
+            return runStep(executor);
+        }
+
+        // Nodes only read the current potentials: chunks of nodes run in parallel, each keeping its own max error.
+        StepResult runStep(utils::cExecutor auto& executor) {
             auto const& fNodes = ctx_.fStructure.fNodes();
             auto const balancer = NodeBalancer{ targetErrorFactor * ctx_.config().targetMaxError() };
-            for (NodeIndex id = 0; id < fNodes.size(); ++id) {
-                auto const& fNode = fNodes[id];
-                if (!fNode.isFoundation) {
-                    auto const evaluator = NodeEvaluator{ ctx_.potentials, ctx_.fStructure.fContactsOf(id), fNode.weight };
-                    auto const balanceResult = balancer.findBalanceOffset(evaluator, ctx_.potentials[id]);
-                    ctx_.nextPotentials[id] = balanceResult.offset;
-                    currentMaxError = rt.max(currentMaxError, balanceResult.initialForce / fNode.weight);
-                } else {
-                    ctx_.nextPotentials[id] = 0.f * u.potential;
+            std::size_t const chunkCount = (fNodes.size() + chunkSize - 1) / chunkSize;
+            chunkMaxErrors_.assign(chunkCount, 0.f);
+            executor.parallelFor(chunkCount, [&](std::size_t chunkId) {
+                Real<u.one> chunkMaxError = 0.f;
+                std::size_t const endId = std::min(fNodes.size(), (chunkId + 1) * chunkSize);
+                for (std::size_t id = chunkId * chunkSize; id < endId; ++id) {
+                    auto const& fNode = fNodes[id];
+                    if (!fNode.isFoundation) {
+                        auto const evaluator = NodeEvaluator{ ctx_.potentials, ctx_.fStructure.fContactsOf(NodeIndex(id)), fNode.weight };
+                        auto const balanceResult = balancer.findBalanceOffset(evaluator, ctx_.potentials[id]);
+                        ctx_.nextPotentials[id] = balanceResult.offset;
+                        chunkMaxError = rt.max(chunkMaxError, balanceResult.initialForce / fNode.weight);
+                    } else {
+                        ctx_.nextPotentials[id] = 0.f * u.potential;
+                    }
                 }
+                chunkMaxErrors_[chunkId] = chunkMaxError;
+            });
+            Real<u.one> currentMaxError = 0.f;
+            for (Real<u.one> const chunkMaxError : chunkMaxErrors_) {
+                currentMaxError = rt.max(currentMaxError, chunkMaxError);
             }
             if (currentMaxError >= ctx_.config().targetMaxError()) {
                 ctx_.potentials.swap(ctx_.nextPotentials);
                 ++ctx_.iterationIndex;
-                return StepResult{ false };
+                return StepResult{ currentMaxError, false };
             } else {
-                return StepResult{ true };
+                return StepResult{ currentMaxError, true };
             }
         }
     private:
         SolverRunContext& ctx_;
+        std::vector<Real<u.one>> chunkMaxErrors_;
     };
 }
@@ -0,0 +1,140 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+
+namespace gustave::core::solvers::force1Solver::detail {
+    // Runs NodeBalancer's algorithm on several load cases in lockstep, so that each
+    // evaluation of the node loads its contacts once for all cases.
+    template<cfg::cLibConfig auto libCfg>
+    class BatchNodeBalancer {
+    private:
+        static constexpr auto u = cfg::units(libCfg);
+        static constexpr auto rt = libCfg.realTraits;
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
+
+        enum class Stage {
+            Start,
+            Advance,
+            Bracket,
+            Done,
+        };
+
+        struct CaseState {
+            Real<u.potential> curOffset = 0.f * u.potential;
+            Real<u.force> curForce = 0.f * u.force;
+            Real<u.conductivity> curConductivity = 0.f * u.conductivity;
+            Real<u.potential> nextOffset = 0.f * u.potential;
+            Real<u.force> nextForce = 0.f * u.force;
+            bool startSignBit = false;
+            Stage stage = Stage::Start;
+        };
+    public:
+        [[nodiscard]]
+        explicit BatchNodeBalancer(Real<u.one> maxErrorFactor, std::size_t caseCount)
+            : maxErrorFactor_{ maxErrorFactor }
+            , states_(caseCount)
+            , evalOffsets_(caseCount, 0.f * u.potential)
+            , evalForces_(caseCount, 0.f * u.force)
+            , evalConductivities_(caseCount, 0.f * u.conductivity)
+        {
+            assert(maxErrorFactor_ > 0.f);
+        }
+
+        void findBalanceOffsets(auto const& evaluator, std::span<Real<u.potential> const> startPotentials,
+            std::span<Real<u.potential>> resultOffsets, std::span<Real<u.force>> initialForces)
+        {
+            std::size_t const count = states_.size();
+            assert(evaluator.caseCount() == count);
+            auto const weights = evaluator.weights();
+            for (std::size_t caseId = 0; caseId < count; ++caseId) {
+                states_[caseId] = CaseState{};
+                evalOffsets_[caseId] = startPotentials[caseId];
+            }
+            std::size_t remaining = count;
+            while (remaining > 0) {
+                evaluator.pointsAt(evalOffsets_, evalForces_, evalConductivities_);
+                for (std::size_t caseId = 0; caseId < count; ++caseId) {
+                    CaseState& state = states_[caseId];
+                    if (state.stage == Stage::Done) {
+                        continue;
+                    }
+                    Real<u.potential> const offset = evalOffsets_[caseId];
+                    Real<u.force> const force = evalForces_[caseId];
+                    Real<u.force> const maxForceError = maxErrorFactor_ * weights[caseId];
+                    if (state.stage == Stage::Start) {
+                        initialForces[caseId] = force;
+                        state.curOffset = offset;
+                        state.curForce = force;
+                        state.curConductivity = evalConductivities_[caseId];
+                        state.startSignBit = rt.signBit(force);
+                        state.stage = Stage::Advance;
+                        evalOffsets_[caseId] = offset + force / state.curConductivity;
+                    } else if (rt.abs(force) <= maxForceError) {
+                        resultOffsets[caseId] = offset;
+                        state.stage = Stage::Done;
+                        remaining -= 1;
+                    } else if (state.stage == Stage::Advance && rt.signBit(force) == state.startSignBit) {
+                        state.curOffset = offset;
+                        state.curForce = force;
+                        state.curConductivity = evalConductivities_[caseId];
+                        evalOffsets_[caseId] = offset + force / state.curConductivity;
+                    } else {
+                        if (state.stage == Stage::Advance) {
+                            state.nextOffset = offset;
+                            state.nextForce = force;
+                            state.stage = Stage::Bracket;
+                        } else if (rt.signBit(force) == state.startSignBit) {
+                            state.curOffset = offset;
+                            state.curForce = force;
+                        } else {
+                            state.nextOffset = offset;
+                            state.nextForce = force;
+                        }
+                        Real<u.resistance> const invDerivative = (state.nextOffset - state.curOffset) / (state.nextForce - state.curForce);
+                        evalOffsets_[caseId] = state.curOffset - invDerivative * state.curForce;
+                    }
+                }
+            }
+        }
+    private:
+        Real<u.one> maxErrorFactor_;
+        std::vector<CaseState> states_;
+        std::vector<Real<u.potential>> evalOffsets_;
+        std::vector<Real<u.force>> evalForces_;
+        std::vector<Real<u.conductivity>> evalConductivities_;
+    };
+}
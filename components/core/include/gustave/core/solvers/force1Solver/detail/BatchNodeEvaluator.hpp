@@ -0,0 +1,97 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+
+namespace gustave::core::solvers::force1Solver::detail {
+    template<cfg::cLibConfig auto libCfg_, typename Contact_>
+    class BatchNodeEvaluator {
+    private:
+        template<cfg::cUnitOf<libCfg_> auto unit>
+        using Real = cfg::Real<libCfg_, unit>;
+
+        static constexpr auto u = cfg::units(libCfg_);
+
+        static constexpr bool hasLocalIndex = requires (Contact_ const& contact) { contact.localIndex(); };
+    public:
+        using Contact = Contact_;
+
+        using Contacts = std::span<Contact const>;
+        using Potentials = std::span<Real<u.potential> const>;
+        using Weights = std::span<Real<u.force> const>;
+
+        [[nodiscard]]
+        explicit BatchNodeEvaluator(Potentials const& potentials, Contacts const& contacts, Weights const& weights)
+            : potentials_{ potentials }
+            , contacts_{ contacts }
+            , weights_{ weights }
+        {}
+
+        [[nodiscard]]
+        std::size_t caseCount() const {
+            return weights_.size();
+        }
+
+        void pointsAt(std::span<Real<u.potential> const> offsets, std::span<Real<u.force>> forces, std::span<Real<u.conductivity>> conductivities) const {
+            std::size_t const count = caseCount();
+            assert(offsets.size() == count);
+            assert(forces.size() == count);
+            assert(conductivities.size() == count);
+            for (std::size_t caseId = 0; caseId < count; ++caseId) {
+                forces[caseId] = weights_[caseId];
+                conductivities[caseId] = 0.f * u.conductivity;
+            }
+            for (auto const& contact : contacts_) {
+                std::size_t const otherBase = contact.otherIndex() * count;
+                for (std::size_t caseId = 0; caseId < count; ++caseId) {
+                    Real<u.potential> localPotential = offsets[caseId];
+                    if constexpr (hasLocalIndex) {
+                        localPotential += potentials_[contact.localIndex() * count + caseId];
+                    }
+                    auto const forceStats = contact.forceStats(localPotential, potentials_[otherBase + caseId]);
+                    forces[caseId] += forceStats.force();
+                    conductivities[caseId] += forceStats.conductivity;
+                }
+            }
+        }
+
+        [[nodiscard]]
+        Weights weights() const {
+            return weights_;
+        }
+    private:
+        Potentials potentials_;
+        Contacts contacts_;
+        Weights weights_;
+    };
+}
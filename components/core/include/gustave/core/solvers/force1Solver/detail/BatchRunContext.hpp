@@ -0,0 +1,159 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/solvers/force1Solver/detail/SolverRunContext.hpp>
+#include <gustave/core/solvers/force1Solver/LoadCase.hpp>
+
+namespace gustave::core::solvers::force1Solver::detail {
+    template<cfg::cLibConfig auto libCfg>
+    struct BatchRunContext {
+    private:
+        static constexpr auto u = cfg::units(libCfg);
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
+
+        using NodeIndex = cfg::NodeIndex<libCfg>;
+
+        using SolverRunContext = detail::SolverRunContext<libCfg>;
+    public:
+        using ClusterStructure = SolverRunContext::ClusterStructure;
+        using Config = SolverRunContext::Config;
+        using F1Structure = SolverRunContext::F1Structure;
+        using IterationIndex = SolverRunContext::IterationIndex;
+        using LayerStructure = SolverRunContext::LayerStructure;
+        using LoadCase = force1Solver::LoadCase<libCfg>;
+        using Structure = SolverRunContext::Structure;
+
+        // All load cases must share the direction of config.g(): conductivities depend on it.
+        [[nodiscard]]
+        explicit BatchRunContext(Structure const& structure, Config const& config, std::span<LoadCase const* const> loadCases)
+            : fStructure{ structure, config }
+            , lStructure{ fStructure }
+            , cStructures{ SolverRunContext::initClusterStuctures(fStructure) }
+            , caseCount{ loadCases.size() }
+            , iterationIndex{ 0 }
+            , nodeWeights(fStructure.fNodes().size() * caseCount, 0.f * u.force)
+            , layerWeights(lStructure.layers().size() * caseCount, 0.f * u.force)
+            , potentials(fStructure.fNodes().size() * caseCount, 0.f * u.potential)
+            , nextPotentials(fStructure.fNodes().size() * caseCount, 0.f * u.potential)
+        {
+            initNodeWeights(structure, loadCases);
+            initLayerWeights();
+            clusterWeights.reserve(cStructures.size());
+            for (ClusterStructure const& cStructure : cStructures) {
+                clusterWeights.push_back(clusterWeightsOf(cStructure));
+            }
+        }
+
+        [[nodiscard]]
+        Config const& config() const {
+            return fStructure.config();
+        }
+
+        // Indexed by node of the solvers::Structure.
+        [[nodiscard]]
+        std::vector<Real<u.potential>> potentialsOfCase(std::size_t caseId) const {
+            std::size_t const nodeCount = fStructure.structure().nodes().size();
+            std::vector<Real<u.potential>> result;
+            result.reserve(nodeCount);
+            for (NodeIndex nodeId = 0; nodeId < nodeCount; ++nodeId) {
+                result.push_back(potentials[fStructure.fNodeIdOf(nodeId) * caseCount + caseId]);
+            }
+            return result;
+        }
+
+        F1Structure fStructure;
+        LayerStructure lStructure;
+        std::vector<ClusterStructure> cStructures;
+        std::size_t caseCount;
+        IterationIndex iterationIndex;
+        // Per-case values are interleaved: value of case k for element i is at index (i * caseCount + k).
+        std::vector<Real<u.force>> nodeWeights;
+        std::vector<Real<u.force>> layerWeights;
+        std::vector<std::vector<Real<u.force>>> clusterWeights;
+        std::vector<Real<u.potential>> potentials;
+        std::vector<Real<u.potential>> nextPotentials;
+    private:
+        void initNodeWeights(Structure const& structure, std::span<LoadCase const* const> loadCases) {
+            auto const& nodes = structure.nodes();
+            for (std::size_t caseId = 0; caseId < caseCount; ++caseId) {
+                LoadCase const& loadCase = *loadCases[caseId];
+                Real<u.acceleration> const gNorm = loadCase.g().norm();
+                for (NodeIndex nodeId = 0; nodeId < nodes.size(); ++nodeId) {
+                    Real<u.mass> mass = nodes[nodeId].mass();
+                    if (loadCase.hasExtraMasses()) {
+                        mass += loadCase.extraMasses()[nodeId];
+                    }
+                    nodeWeights[fStructure.fNodeIdOf(nodeId) * caseCount + caseId] += gNorm * mass;
+                }
+            }
+        }
+
+        void initLayerWeights() {
+            auto const& layers = lStructure.layers();
+            auto const& layerOfNode = lStructure.layerOfNode();
+            for (NodeIndex nodeId = 0; nodeId < layerOfNode.size(); ++nodeId) {
+                std::size_t const layerBase = layerOfNode[nodeId] * caseCount;
+                for (std::size_t caseId = 0; caseId < caseCount; ++caseId) {
+                    layerWeights[layerBase + caseId] += nodeWeights[nodeId * caseCount + caseId];
+                }
+            }
+            for (std::size_t layerId = layers.size(); layerId > 0; --layerId) {
+                auto const& layer = layers[layerId - 1];
+                if (!layer.isFoundation()) {
+                    std::size_t const lowBase = layer.lowLayerId() * caseCount;
+                    for (std::size_t caseId = 0; caseId < caseCount; ++caseId) {
+                        layerWeights[lowBase + caseId] += layerWeights[(layerId - 1) * caseCount + caseId];
+                    }
+                }
+            }
+        }
+
+        [[nodiscard]]
+        std::vector<Real<u.force>> clusterWeightsOf(ClusterStructure const& cStructure) const {
+            std::vector<Real<u.force>> result(cStructure.clusters().size() * caseCount, 0.f * u.force);
+            auto const& clusterOfNode = cStructure.clusterOfNode();
+            for (NodeIndex nodeId = 0; nodeId < clusterOfNode.size(); ++nodeId) {
+                auto const clusterId = clusterOfNode[nodeId];
+                if (clusterId != cStructure.invalidClusterId()) {
+                    for (std::size_t caseId = 0; caseId < caseCount; ++caseId) {
+                        result[clusterId * caseCount + caseId] += nodeWeights[nodeId * caseCount + caseId];
+                    }
+                }
+            }
+            return result;
+        }
+    };
+}
@@ -0,0 +1,173 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/solvers/force1Solver/detail/BatchNodeBalancer.hpp>
+#include <gustave/core/solvers/force1Solver/detail/BatchNodeEvaluator.hpp>
+#include <gustave/core/solvers/force1Solver/detail/BatchRunContext.hpp>
+
+namespace gustave::core::solvers::force1Solver::detail {
+    template<cfg::cLibConfig auto libCfg>
+    class BatchStepRunner {
+    private:
+        static constexpr auto u = cfg::units(libCfg);
+        static constexpr auto rt = libCfg.realTraits;
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
+
+        using NodeIndex = cfg::NodeIndex<libCfg>;
+
+        using BatchRunContext = detail::BatchRunContext<libCfg>;
+        using NodeBalancer = detail::BatchNodeBalancer<libCfg>;
+
+        using ClusterStructure = BatchRunContext::ClusterStructure;
+        using F1Contact = BatchRunContext::F1Structure::F1Contact;
+        using LocalContact = BatchRunContext::LayerStructure::LayerContact;
+
+        using BasicEvaluator = detail::BatchNodeEvaluator<libCfg, F1Contact>;
+        using LocalEvaluator = detail::BatchNodeEvaluator<libCfg, LocalContact>;
+    public:
+        static constexpr Real<u.one> targetErrorFactor = 0.75f;
+
+        struct StepResult {
+            bool isBelowTargetError;
+        };
+
+        [[nodiscard]]
+        explicit BatchStepRunner(BatchRunContext& ctx)
+            : ctx_{ ctx }
+            , balancer_{ targetErrorFactor * ctx.config().targetMaxError(), ctx.caseCount }
+            , startPotentials_(ctx.caseCount, 0.f * u.potential)
+            , offsets_(ctx.caseCount, 0.f * u.potential)
+            , initialForces_(ctx.caseCount, 0.f * u.force)
+        {}
+
+        StepResult runBasicStep() {
+            std::size_t const count = ctx_.caseCount;
+            auto const& fNodes = ctx_.fStructure.fNodes();
+            Real<u.one> currentMaxError = 0.f;
+            for (NodeIndex nodeId = 0; nodeId < fNodes.size(); ++nodeId) {
+                std::size_t const base = nodeId * count;
+                auto const nextPotentials = std::span{ ctx_.nextPotentials }.subspan(base, count);
+                if (!fNodes[nodeId].isFoundation) {
+                    auto const weights = weightsOf(ctx_.nodeWeights, nodeId);
+                    auto const evaluator = BasicEvaluator{ ctx_.potentials, ctx_.fStructure.fContactsOf(nodeId), weights };
+                    auto const startPotentials = std::span<Real<u.potential> const>{ ctx_.potentials }.subspan(base, count);
+                    balancer_.findBalanceOffsets(evaluator, startPotentials, nextPotentials, initialForces_);
+                    for (std::size_t caseId = 0; caseId < count; ++caseId) {
+                        currentMaxError = rt.max(currentMaxError, initialForces_[caseId] / weights[caseId]);
+                    }
+                } else {
+                    for (auto& potential : nextPotentials) {
+                        potential = 0.f * u.potential;
+                    }
+                }
+            }
+            if (currentMaxError >= ctx_.config().targetMaxError()) {
+                ctx_.potentials.swap(ctx_.nextPotentials);
+                ++ctx_.iterationIndex;
+                return StepResult{ false };
+            } else {
+                return StepResult{ true };
+            }
+        }
+
+        void runClusterStep(std::size_t cStructureId) {
+            std::size_t const count = ctx_.caseCount;
+            ClusterStructure const& cStructure = ctx_.cStructures[cStructureId];
+            auto const& clusters = cStructure.clusters();
+            auto const& clusterWeights = ctx_.clusterWeights[cStructureId];
+            auto& clusterPotentials = ctx_.nextPotentials;
+            for (NodeIndex clusterId = 0; clusterId < clusters.size(); ++clusterId) {
+                auto const evaluator = LocalEvaluator{ ctx_.potentials, cStructure.contactsOf(clusterId), weightsOf(clusterWeights, clusterId) };
+                auto const results = std::span{ clusterPotentials }.subspan(clusterId * count, count);
+                balancer_.findBalanceOffsets(evaluator, startPotentials_, results, initialForces_);
+            }
+            auto const& clusterOfNode = cStructure.clusterOfNode();
+            for (NodeIndex nodeId = 0; nodeId < clusterOfNode.size(); ++nodeId) {
+                auto const clusterId = clusterOfNode[nodeId];
+                if (clusterId != cStructure.invalidClusterId()) {
+                    for (std::size_t caseId = 0; caseId < count; ++caseId) {
+                        ctx_.potentials[nodeId * count + caseId] += clusterPotentials[clusterId * count + caseId];
+                    }
+                }
+            }
+            ++ctx_.iterationIndex;
+        }
+
+        void runLayerStep() {
+            std::size_t const count = ctx_.caseCount;
+            auto const& lStructure = ctx_.lStructure;
+            auto const& layers = lStructure.layers();
+            auto& layerOffsets = ctx_.nextPotentials;
+            assert(layerOffsets.size() >= layers.size() * count);
+            for (NodeIndex layerId = 0; layerId < layers.size(); ++layerId) {
+                auto const& layer = layers[layerId];
+                auto const results = std::span{ layerOffsets }.subspan(layerId * count, count);
+                if (layer.isFoundation()) {
+                    for (auto& offset : results) {
+                        offset = 0.f * u.potential;
+                    }
+                } else {
+                    auto const lowLayerId = layer.lowLayerId();
+                    assert(lowLayerId < layerId);
+                    auto const evaluator = LocalEvaluator{ ctx_.potentials, lStructure.lowContactsOf(layerId), weightsOf(ctx_.layerWeights, layerId) };
+                    balancer_.findBalanceOffsets(evaluator, startPotentials_, offsets_, initialForces_);
+                    for (std::size_t caseId = 0; caseId < count; ++caseId) {
+                        results[caseId] = layerOffsets[lowLayerId * count + caseId] + offsets_[caseId];
+                    }
+                }
+            }
+            auto const& layerOfNode = lStructure.layerOfNode();
+            for (NodeIndex nodeId = 0; nodeId < layerOfNode.size(); ++nodeId) {
+                for (std::size_t caseId = 0; caseId < count; ++caseId) {
+                    ctx_.potentials[nodeId * count + caseId] += layerOffsets[layerOfNode[nodeId] * count + caseId];
+                }
+            }
+            ++ctx_.iterationIndex;
+        }
+    private:
+        [[nodiscard]]
+        std::span<Real<u.force> const> weightsOf(std::vector<Real<u.force>> const& weights, std::size_t index) const {
+            return std::span{ weights }.subspan(index * ctx_.caseCount, ctx_.caseCount);
+        }
+
+        BatchRunContext& ctx_;
+        NodeBalancer balancer_;
+        std::vector<Real<u.potential>> startPotentials_;
+        std::vector<Real<u.potential>> offsets_;
+        std::vector<Real<u.force>> initialForces_;
+    };
+}
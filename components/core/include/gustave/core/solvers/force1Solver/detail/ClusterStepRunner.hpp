@@ -25,12 +25,15 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/cfg/cUnitOf.hpp>
 #include <gustave/cfg/LibTraits.hpp>
 #include <gustave/core/solvers/force1Solver/detail/ClusterNodeEvaluator.hpp>
 #include <gustave/core/solvers/force1Solver/detail/NodeBalancer.hpp>
 #include <gustave/core/solvers/force1Solver/detail/SolverRunContext.hpp>
+#include <gustave/utils/cExecutor.hpp>
 
 namespace gustave::core::solvers::force1Solver::detail {
     template<cfg::cLibConfig auto libCfg>
@@ -63,22 +66,22 @@ namespace gustave::core::solvers::force1Solver::detail {
             : ctx_{ ctx }
         {}
 
-        void runStep(ClusterStructure const& cStructure) {
+        void runStep(ClusterStructure const& cStructure, utils::cExecutor auto& executor) {
             auto const& cNodes = cStructure.clusters();
             auto const balancer = NodeBalancer{ targetErrorFactor * ctx_.config().targetMaxError() };
             auto const clusterPotentials = std::span<Real<u.potential>>{ ctx_.nextPotentials };
-            for (ClusterIndex cId = 0; cId < cNodes.size(); ++cId) {
-                auto const evaluator = NodeEvaluator{ ctx_.potentials, cStructure.contactsOf(cId), cNodes[cId].weight() };
+            executor.parallelFor(cNodes.size(), [&](std::size_t cId) {
+                auto const evaluator = NodeEvaluator{ ctx_.potentials, cStructure.contactsOf(ClusterIndex(cId)), cNodes[cId].weight() };
                 auto const balanceResult = balancer.findBalanceOffset(evaluator, 0.f * u.potential);
                 clusterPotentials[cId] = balanceResult.offset;
-            }
+            });
             auto const& clusterOfNode = cStructure.clusterOfNode();
-            for (NodeIndex nodeId = 0; nodeId < ctx_.fStructure.fNodes().size(); ++nodeId) {
+            executor.parallelFor(ctx_.fStructure.fNodes().size(), [&](std::size_t nodeId) {
                 ClusterIndex const clusterId = clusterOfNode[nodeId];
                 if (clusterId != cStructure.invalidClusterId()) {
                     ctx_.potentials[nodeId] += clusterPotentials[clusterId];
                 }
-            }
+            });
             ++ctx_.iterationIndex;
         }
     private:
@@ -25,6 +25,8 @@
 
 #pragma once
 
+#include <cassert>
+#include <cstddef>
 #include <deque>
 #include <span>
 #include <vector>
@@ -85,7 +87,7 @@ namespace gustave::core::solvers::force1Solver::detail {
         explicit ClusterStructure(F1Structure const& fStructure, NodeIndex const widthLimit = 1)
             : clusterOfNode_(fStructure.fNodes().size(), invalidClusterId())
         {
-            NodeIndex const nodeCount = fStructure.fNodes().size();
+            auto const nodeCount = static_cast<NodeIndex>(fStructure.fNodes().size());
 
             auto numContactsOf = std::vector<ContactIndex>{};
             numContactsOf.reserve(nodeCount);
@@ -153,7 +155,7 @@ namespace gustave::core::solvers::force1Solver::detail {
 
             for (NodeIndex rootId = 0; rootId < nodeCount; ++rootId) {
                 if (numContactsOf[rootId] > 0) {
-                    ClusterIndex const clusterId = clusters_.size();
+                    auto const clusterId = static_cast<ClusterIndex>(clusters_.size());
                     std::deque<NodeIndex> nodes = selectNodes(rootId, clusterId);
                     Real<u.force> weight = 0.f * u.force;
                     ContactIndex const startContactIds = ContactIndex(contacts_.size());
@@ -167,6 +169,7 @@ namespace gustave::core::solvers::force1Solver::detail {
                                 hasNonRootContact = hasNonRootContact || !fStructure.fNodes()[otherId].isFoundation;
                                 sizeContactIds += 1;
                                 contacts_.emplace_back(fContact.basicContact(), nId);
+                                contactSources_.push_back(fStructure.contactIdOf(fContact));
                             }
                         }
                     }
@@ -178,12 +181,58 @@ namespace gustave::core::solvers::force1Solver::detail {
                         }
                         for (std::size_t i = 0; i < sizeContactIds; ++i) {
                             contacts_.pop_back();
+                            contactSources_.pop_back();
                         }
                     }
                 }
             }
             clusters_.shrink_to_fit();
             contacts_.shrink_to_fit();
+            contactSources_.shrink_to_fit();
+        }
+
+        // Same decomposition as `other`, for an F1Structure of the same topology: the weights and conductivities
+        // are read from fStructure.
+        [[nodiscard]]
+        explicit ClusterStructure(ClusterStructure const& other, F1Structure const& fStructure)
+            : clusterOfNode_{ other.clusterOfNode_ }
+            , contactSources_{ other.contactSources_ }
+        {
+            auto const& fNodes = fStructure.fNodes();
+            assert(clusterOfNode_.size() == fNodes.size());
+            std::vector<Real<u.force>> weights(other.clusters_.size(), 0.f * u.force);
+            for (NodeIndex nodeId = 0; nodeId < fNodes.size(); ++nodeId) {
+                ClusterIndex const clusterId = clusterOfNode_[nodeId];
+                if (clusterId != invalidClusterId()) {
+                    weights[clusterId] += fNodes[nodeId].weight;
+                }
+            }
+            clusters_.reserve(other.clusters_.size());
+            for (std::size_t clusterId = 0; clusterId < other.clusters_.size(); ++clusterId) {
+                clusters_.emplace_back(other.clusters_[clusterId].contactIds(), weights[clusterId]);
+            }
+            contacts_.reserve(other.contacts_.size());
+            for (std::size_t contactId = 0; contactId < other.contacts_.size(); ++contactId) {
+                auto const& fContact = fStructure.fContacts()[contactSources_[contactId]];
+                contacts_.emplace_back(fContact.basicContact(), other.contacts_[contactId].localIndex());
+            }
+        }
+
+        // Same decomposition as a ClusterStructure of another precision, values converted by `convert`.
+        template<cfg::cLibConfig auto otherCfg>
+        [[nodiscard]]
+        explicit ClusterStructure(ClusterStructure<otherCfg> const& other, auto const& convert)
+            : clusterOfNode_( other.clusterOfNode().begin(), other.clusterOfNode().end() )
+            , contactSources_( other.contactSources().begin(), other.contactSources().end() )
+        {
+            clusters_.reserve(other.clusters().size());
+            for (auto const& cluster : other.clusters()) {
+                clusters_.emplace_back(cluster.contactIds(), convert(cluster.weight()));
+            }
+            contacts_.reserve(other.contacts().size());
+            for (auto const& contact : other.contacts()) {
+                contacts_.emplace_back(contact, convert);
+            }
         }
 
         [[nodiscard]]
@@ -205,9 +254,25 @@ namespace gustave::core::solvers::force1Solver::detail {
         std::span<ClusterContact const> contactsOf(NodeIndex nodeId) const {
             return clusters_[nodeId].contactIds().subSpanOf(contacts_);
         }
+
+        // Index in F1Structure::fContacts() of each contact of contacts().
+        [[nodiscard]]
+        std::vector<ContactIndex> const& contactSources() const {
+            return contactSources_;
+        }
+
+        // Bytes allocated on the heap by this structure.
+        [[nodiscard]]
+        std::size_t memoryUsage() const {
+            return clusters_.capacity() * sizeof(Cluster)
+                + clusterOfNode_.capacity() * sizeof(ClusterIndex)
+                + contacts_.capacity() * sizeof(ClusterContact)
+                + contactSources_.capacity() * sizeof(ContactIndex);
+        }
     private:
         std::vector<Cluster> clusters_;
         std::vector<ClusterIndex> clusterOfNode_;
         std::vector<ClusterContact> contacts_;
+        std::vector<ContactIndex> contactSources_;
     };
 }
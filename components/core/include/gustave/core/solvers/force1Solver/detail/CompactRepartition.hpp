@@ -0,0 +1,174 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/solvers/force1Solver/detail/F1Structure.hpp>
+#include <gustave/core/solvers/force1Solver/detail/ForceRepartition.hpp>
+
+namespace gustave::core::solvers::force1Solver::detail {
+    // Compact alternative to an F1Structure and its ForceRepartition: the links of each node, and the force on the local
+    // contact of each link (computed once from the potentials, with the conductivity matching its sign).
+    template<cfg::cLibConfig auto libCfg>
+    class CompactRepartition {
+    private:
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
+
+        // Index in nodeLinkIds_.
+        using LocalLinkIndex = cfg::LinkIndex<libCfg>;
+        using NodeIndex = cfg::NodeIndex<libCfg>;
+
+        using ForceRepartition = detail::ForceRepartition<libCfg>;
+
+        static constexpr auto u = cfg::units(libCfg);
+        static constexpr auto rt = libCfg.realTraits;
+    public:
+        using F1Structure = detail::F1Structure<libCfg>;
+        using Structure = F1Structure::Structure;
+
+        using ContactIndex = Structure::ContactIndex;
+        using Link = Structure::Link;
+        using LinkIndex = cfg::LinkIndex<libCfg>;
+        using LocalLinkIds = std::span<LinkIndex const>;
+        using Node = Structure::Node;
+
+        // Potentials and node indices are the ones of the solvers::Structure, not of the F1Nodes.
+        [[nodiscard]]
+        explicit CompactRepartition(F1Structure const& fStructure, std::span<Real<u.potential> const> potentials)
+            : structure_{ &fStructure.structure() }
+            , extraMasses_{ fStructure.extraMasses() }
+            , gNorm_{ fStructure.g().norm() }
+        {
+            assert(potentials.size() == nodes().size());
+            nodeLinkStarts_.reserve(nodes().size() + 1);
+            nodeLinkIds_.reserve(2 * links().size());
+            for (NodeIndex nodeId = 0; nodeId < nodes().size(); ++nodeId) {
+                nodeLinkStarts_.push_back(static_cast<LocalLinkIndex>(nodeLinkIds_.size()));
+                for (auto const& fContact : fStructure.nodeContactsOf(nodeId)) {
+                    nodeLinkIds_.push_back(fContact.linkIndex());
+                }
+            }
+            nodeLinkStarts_.push_back(static_cast<LocalLinkIndex>(nodeLinkIds_.size()));
+            auto const repartition = ForceRepartition{ fStructure, potentials };
+            localForces_.reserve(links().size());
+            for (LinkIndex linkId = 0; linkId < links().size(); ++linkId) {
+                localForces_.push_back(repartition.forceCoordOnContact(ContactIndex{ linkId, true }));
+            }
+        }
+
+        [[nodiscard]]
+        Real<u.force> forceCoord(NodeIndex to, NodeIndex from) const {
+            Real<u.force> result = Real<u.force>::zero();
+            for (LinkIndex const linkId : linkIdsOf(to)) {
+                Link const& link = links()[linkId];
+                bool const isOnLocalNode = (link.localNodeId() == to);
+                NodeIndex const otherId = isOnLocalNode ? link.otherNodeId() : link.localNodeId();
+                if (otherId == from) {
+                    result += forceCoordOnContact(ContactIndex{ linkId, isOnLocalNode });
+                }
+            }
+            return result;
+        }
+
+        [[nodiscard]]
+        Real<u.force> forceCoordOnContact(ContactIndex const& index) const {
+            Real<u.force> const localForce = localForces_[index.linkIndex];
+            return index.isOnLocalNode ? localForce : -localForce;
+        }
+
+        // Links of a node, in the same order as F1Structure::nodeContactsOf().
+        [[nodiscard]]
+        LocalLinkIds linkIdsOf(NodeIndex nodeId) const {
+            LocalLinkIndex const start = nodeLinkStarts_[nodeId];
+            return LocalLinkIds{ nodeLinkIds_ }.subspan(start, nodeLinkStarts_[nodeId + 1] - start);
+        }
+
+        [[nodiscard]]
+        Real<u.one> maxRelativeError() const {
+            Real<u.one> result = 0.f;
+            for (NodeIndex id = 0; id < nodes().size(); ++id) {
+                if (!nodes()[id].isFoundation) {
+                    result = rt.max(result, relativeErrorOf(id));
+                }
+            }
+            return result;
+        }
+
+        // Bytes allocated on the heap by this repartition.
+        [[nodiscard]]
+        std::size_t memoryUsage() const {
+            return nodeLinkStarts_.capacity() * sizeof(LocalLinkIndex)
+                + nodeLinkIds_.capacity() * sizeof(LinkIndex)
+                + localForces_.capacity() * sizeof(Real<u.force>);
+        }
+
+        // Weight of the node, plus the forces of its contacts.
+        [[nodiscard]]
+        Real<u.force> netForceCoord(NodeIndex nodeId) const {
+            Real<u.force> result = weightOf(nodeId);
+            for (LinkIndex const linkId : linkIdsOf(nodeId)) {
+                result += forceCoordOnContact(ContactIndex{ linkId, links()[linkId].localNodeId() == nodeId });
+            }
+            return result;
+        }
+
+        [[nodiscard]]
+        Real<u.one> relativeErrorOf(NodeIndex nodeId) const {
+            return rt.abs(netForceCoord(nodeId) / weightOf(nodeId));
+        }
+    private:
+        [[nodiscard]]
+        std::vector<Link> const& links() const {
+            return structure_->links();
+        }
+
+        [[nodiscard]]
+        std::vector<Node> const& nodes() const {
+            return structure_->nodes();
+        }
+
+        [[nodiscard]]
+        Real<u.force> weightOf(NodeIndex nodeId) const {
+            Real<u.mass> const mass = nodes()[nodeId].mass();
+            return gNorm_ * (extraMasses_.empty() ? mass : mass + extraMasses_[nodeId]);
+        }
+
+        Structure const* structure_;
+        std::span<Real<u.mass> const> extraMasses_;
+        Real<u.acceleration> gNorm_;
+        std::vector<LocalLinkIndex> nodeLinkStarts_;
+        std::vector<LinkIndex> nodeLinkIds_;
+        std::vector<Real<u.force>> localForces_;
+    };
+}
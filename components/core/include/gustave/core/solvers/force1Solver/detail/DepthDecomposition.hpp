@@ -55,7 +55,7 @@ namespace gustave::core::solvers::force1Solver::detail {
                 if (fNode.isFoundation) {
                     isNodeReached[nodeId] = true;
                     depthOfNode[nodeId] = 0;
-                    curNodes.push_back(nodeId);
+                    curNodes.push_back(static_cast<NodeIndex>(nodeId));
                 }
             }
 
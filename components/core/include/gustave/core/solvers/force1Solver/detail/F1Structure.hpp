@@ -25,7 +25,10 @@
 
 #pragma once
 
+#include <cassert>
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <span>
 #include <vector>
 
@@ -75,33 +78,66 @@ namespace gustave::core::solvers::force1Solver::detail {
         using LocalContacts = std::span<F1Contact const>;
         using Node = Structure::Node;
 
+        // extraMasses: per-node masses added to the ones of the structure (load case overlay), or empty.
         [[nodiscard]]
-        explicit F1Structure(Structure const& structure, Config const& config)
+        explicit F1Structure(Structure const& structure, Config const& config, std::span<Real<u.mass> const> extraMasses = {})
             : config_{ &config }
             , structure_{ &structure }
+            , extraMasses_{ extraMasses }
             , normalizedG_{ config_->g() }
         {
+            assert(extraMasses_.empty() || extraMasses_.size() == structure.nodes().size());
             Real<u.acceleration> const gNorm = g().norm();
             auto const& nodes = structure_->nodes();
-            fNodes_.reserve(nodes.size());
-            for (Node const& node : nodes) {
-                fNodes_.emplace_back(gNorm * node.mass(), node.isFoundation);
+            // All foundations are merged into a single F1Node, numbered where the first foundation appears.
+            fNodeIdOf_.reserve(nodes.size());
+            std::optional<NodeIndex> foundationId;
+            for (NodeIndex nodeId = 0; nodeId < nodes.size(); ++nodeId) {
+                Node const& node = nodes[nodeId];
+                Real<u.force> const weight = gNorm * massOf(nodeId);
+                auto const newId = static_cast<NodeIndex>(fNodes_.size());
+                if (!node.isFoundation) {
+                    fNodeIdOf_.push_back(newId);
+                    fNodes_.emplace_back(weight, false);
+                } else if (foundationId) {
+                    fNodeIdOf_.push_back(*foundationId);
+                    fNodes_[*foundationId].weight += weight;
+                } else {
+                    foundationId = newId;
+                    fNodeIdOf_.push_back(*foundationId);
+                    fNodes_.emplace_back(weight, true);
+                }
             }
             auto const& links = structure.links();
+            nodeContactIds_.resize(nodes.size());
             fLinks_.reserve(links.size());
             for (LinkIndex linkId = 0; linkId < links.size(); ++linkId) {
                 Link const& link = links[linkId];
-                auto& localContactIds = fNodes_[link.localNodeId()].contactIds;
-                auto& otherContactIds = fNodes_[link.otherNodeId()].contactIds;
+                auto& localContactIds = nodeContactIds_[link.localNodeId()];
+                auto& otherContactIds = nodeContactIds_[link.otherNodeId()];
                 fLinks_.push_back(F1Link{ localContactIds.size(), otherContactIds.size() });
                 localContactIds.setSize(1 + localContactIds.size());
                 otherContactIds.setSize(1 + otherContactIds.size());
             }
+            for (NodeIndex nodeId = 0; nodeId < nodes.size(); ++nodeId) {
+                auto& fContactIds = fNodes_[fNodeIdOf_[nodeId]].contactIds;
+                fContactIds.setSize(fContactIds.size() + nodeContactIds_[nodeId].size());
+            }
             ContactIndex startId = 0;
             for (F1Node& fNode : fNodes_) {
                 fNode.contactIds.setStart(startId);
                 startId += fNode.contactIds.size();
             }
+            // The contacts of the merged foundations are consecutive sub-ranges of the foundation F1Node.
+            ContactIndex foundationOffset = 0;
+            for (NodeIndex nodeId = 0; nodeId < nodes.size(); ++nodeId) {
+                auto& contactIds = nodeContactIds_[nodeId];
+                contactIds.setStart(fNodes_[fNodeIdOf_[nodeId]].contactIds.start());
+                if (nodes[nodeId].isFoundation) {
+                    contactIds.setStart(contactIds.start() + foundationOffset);
+                    foundationOffset += contactIds.size();
+                }
+            }
             // NOTE: std::vector::resize initializes the content, which isn't needed here. But no easy alternative with std::vector...
             fContacts_.resize(2 * links.size(), F1Contact{ 0, 0, infConductivity, infConductivity });
             for (LinkIndex linkId = 0; linkId < links.size(); ++linkId) {
@@ -118,10 +154,10 @@ namespace gustave::core::solvers::force1Solver::detail {
                 Real<u.conductivity> const nCond = rt.min(normalCond.minus, tangentCond);
 
                 F1Link const& fLink = fLinks_[linkId];
-                ContactIndex const contactId1 = fNodes_[id1].contactIds.start() + fLink.localContactId;
-                fContacts_[contactId1] = F1Contact{ id2, linkId, pCond, nCond };
-                ContactIndex const contactId2 = fNodes_[id2].contactIds.start() + fLink.otherContactId;
-                fContacts_[contactId2] = F1Contact{ id1, linkId, nCond, pCond };
+                ContactIndex const contactId1 = nodeContactIds_[id1].start() + fLink.localContactId;
+                fContacts_[contactId1] = F1Contact{ fNodeIdOf_[id2], linkId, pCond, nCond };
+                ContactIndex const contactId2 = nodeContactIds_[id2].start() + fLink.otherContactId;
+                fContacts_[contactId2] = F1Contact{ fNodeIdOf_[id1], linkId, nCond, pCond };
             }
         }
 
@@ -130,11 +166,23 @@ namespace gustave::core::solvers::force1Solver::detail {
             return *config_;
         }
 
+        // Index in fContacts() of a contact returned by fContactsOf(). Depends only on the topology of structure().
+        [[nodiscard]]
+        ContactIndex contactIdOf(F1Contact const& fContact) const {
+            assert(&fContact >= fContacts_.data() && &fContact < fContacts_.data() + fContacts_.size());
+            return static_cast<ContactIndex>(&fContact - fContacts_.data());
+        }
+
         [[nodiscard]]
         Vector3<u.acceleration> const& g() const {
             return config_->g();
         }
 
+        [[nodiscard]]
+        std::span<Real<u.mass> const> extraMasses() const {
+            return extraMasses_;
+        }
+
         [[nodiscard]]
         std::vector<F1Contact> const& fContacts() const {
             return fContacts_;
@@ -150,16 +198,67 @@ namespace gustave::core::solvers::force1Solver::detail {
             return fLinks_;
         }
 
+        [[nodiscard]]
+        NodeIndex fNodeIdOf(NodeIndex nodeId) const {
+            return fNodeIdOf_[nodeId];
+        }
+
         [[nodiscard]]
         std::vector<F1Node> const& fNodes() const {
             return fNodes_;
         }
 
+        // Potentials indexed by F1Node, from potentials indexed by node of structure().
+        [[nodiscard]]
+        std::vector<Real<u.potential>> fPotentialsOf(std::span<Real<u.potential> const> potentials) const {
+            assert(potentials.size() == fNodeIdOf_.size());
+            std::vector<Real<u.potential>> result(fNodes_.size(), 0.f * u.potential);
+            for (NodeIndex nodeId = 0; nodeId < potentials.size(); ++nodeId) {
+                result[fNodeIdOf_[nodeId]] = potentials[nodeId];
+            }
+            return result;
+        }
+
+        // Mass of a node of structure(), extra mass included.
+        [[nodiscard]]
+        Real<u.mass> massOf(NodeIndex nodeId) const {
+            Real<u.mass> const mass = structure_->nodes()[nodeId].mass();
+            return extraMasses_.empty() ? mass : mass + extraMasses_[nodeId];
+        }
+
+        // Bytes allocated on the heap by this structure.
+        [[nodiscard]]
+        std::size_t memoryUsage() const {
+            return fContacts_.capacity() * sizeof(F1Contact)
+                + fLinks_.capacity() * sizeof(F1Link)
+                + fNodeIdOf_.capacity() * sizeof(NodeIndex)
+                + fNodes_.capacity() * sizeof(F1Node)
+                + nodeContactIds_.capacity() * sizeof(typename F1Node::ContactIds);
+        }
+
+        // Contacts of a node of structure(): a sub-range of the contacts of its F1Node.
+        [[nodiscard]]
+        LocalContacts nodeContactsOf(NodeIndex nodeId) const {
+            return nodeContactIds_[nodeId].subSpanOf(fContacts_);
+        }
+
         [[nodiscard]]
         NormalizedVector3 const& normalizedG() const {
             return normalizedG_;
         }
 
+        // Potentials indexed by node of structure(), from potentials indexed by F1Node.
+        [[nodiscard]]
+        std::vector<Real<u.potential>> potentialsOf(std::span<Real<u.potential> const> fPotentials) const {
+            assert(fPotentials.size() == fNodes_.size());
+            std::vector<Real<u.potential>> result;
+            result.reserve(fNodeIdOf_.size());
+            for (NodeIndex fNodeId : fNodeIdOf_) {
+                result.push_back(fPotentials[fNodeId]);
+            }
+            return result;
+        }
+
         [[nodiscard]]
         Structure const& structure() const {
             return *structure_;
@@ -191,9 +290,12 @@ namespace gustave::core::solvers::force1Solver::detail {
 
         Config const* config_;
         Structure const* structure_;
+        std::span<Real<u.mass> const> extraMasses_;
         std::vector<F1Contact> fContacts_;
         std::vector<F1Link> fLinks_;
+        std::vector<NodeIndex> fNodeIdOf_;
         std::vector<F1Node> fNodes_;
+        std::vector<typename F1Node::ContactIds> nodeContactIds_;
         NormalizedVector3 normalizedG_;
     };
 }
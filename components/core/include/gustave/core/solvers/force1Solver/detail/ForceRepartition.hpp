@@ -31,7 +31,6 @@
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/cfg/cUnitOf.hpp>
 #include <gustave/cfg/LibTraits.hpp>
-#include <gustave/core/solvers/force1Solver/detail/BasicNodeEvaluator.hpp>
 #include <gustave/core/solvers/force1Solver/detail/F1Structure.hpp>
 #include <gustave/core/solvers/force1Solver/detail/NodePoint.hpp>
 
@@ -47,8 +46,6 @@ namespace gustave::core::solvers::force1Solver::detail {
 
         using NodeIndex = cfg::NodeIndex<libCfg>;
 
-        using NodeEvaluator = detail::BasicNodeEvaluator<libCfg>;
-
         static constexpr auto u = cfg::units(libCfg);
         static constexpr auto rt = libCfg.realTraits;
     public:
@@ -65,6 +62,7 @@ namespace gustave::core::solvers::force1Solver::detail {
         using Node = Structure::Node;
         using NodeStats = detail::NodePoint<libCfg>;
 
+        // Potentials and node indices are the ones of the solvers::Structure, not of the F1Nodes (see F1Structure::potentialsOf()).
         [[nodiscard]]
         explicit ForceRepartition(F1Structure const& fStructure, std::span<Real<u.potential> const> potentials)
             : fStructure_{ fStructure }
@@ -75,7 +73,7 @@ namespace gustave::core::solvers::force1Solver::detail {
 
         [[nodiscard]]
         Real<u.one> relativeErrorOf(NodeIndex id) const {
-            return rt.abs(statsOf(id).force() / fStructure_.fNodes()[id].weight);
+            return rt.abs(statsOf(id).force() / weightOf(id));
         }
 
         [[nodiscard]]
@@ -102,17 +100,24 @@ namespace gustave::core::solvers::force1Solver::detail {
 
         [[nodiscard]]
         NodeStats statsOf(NodeIndex const nodeId) const {
-            auto const evaluator = NodeEvaluator{ potentials_, fStructure_.fContactsOf(nodeId), fStructure_.fNodes()[nodeId].weight };
-            return evaluator.pointAt(potentials_[nodeId]);
+            Real<u.potential> const potential = potentials_[nodeId];
+            Real<u.force> force = weightOf(nodeId);
+            Real<u.conductivity> conductivity = 0.f * u.conductivity;
+            for (F1Contact const& fContact : fStructure_.nodeContactsOf(nodeId)) {
+                ContactStats const stats = contactStatsOf(nodeId, fContact, potential);
+                conductivity += stats.conductivity;
+                force += stats.force();
+            }
+            return NodeStats{ potential, force, conductivity };
         }
 
         [[nodiscard]]
         Real<u.force> forceCoord(NodeIndex to, NodeIndex from) const {
             Real<u.force> result = Real<u.force>::zero();
             Real<u.potential> const toPotential = potentials_[to];
-            for (F1Contact const& fContact : fStructure_.fContactsOf(to)) {
-                if (fContact.otherIndex() == from) {
-                    result += contactStatsOf(fContact, toPotential).force();
+            for (F1Contact const& fContact : fStructure_.nodeContactsOf(to)) {
+                if (otherNodeIdOf(to, fContact) == from) {
+                    result += contactStatsOf(to, fContact, toPotential).force();
                 }
             }
             return result;
@@ -124,8 +129,8 @@ namespace gustave::core::solvers::force1Solver::detail {
             F1Link const& fLink = fStructure_.fLinks()[index.linkIndex];
             NodeIndex const nodeId = index.isOnLocalNode ? link.localNodeId() : link.otherNodeId();
             LocalContactIndex const localContactId = index.isOnLocalNode ? fLink.localContactId : fLink.otherContactId;
-            F1Contact const& fContact = fStructure_.fContactsOf(nodeId)[localContactId];
-            ContactStats const stats = contactStatsOf(fContact, potentials_[nodeId]);
+            F1Contact const& fContact = fStructure_.nodeContactsOf(nodeId)[localContactId];
+            ContactStats const stats = contactStatsOf(nodeId, fContact, potentials_[nodeId]);
             return stats.force();
         }
 
@@ -148,13 +153,20 @@ namespace gustave::core::solvers::force1Solver::detail {
         }
 
         [[nodiscard]]
-        std::vector<F1Node> const& fNodes() const {
-            return fStructure_.fNodes();
+        Real<u.force> weightOf(NodeIndex nodeId) const {
+            return fStructure_.g().norm() * fStructure_.massOf(nodeId);
+        }
+
+        [[nodiscard]]
+        ContactStats contactStatsOf(NodeIndex nodeId, F1Contact const& fContact, Real<u.potential> const localPotential) const {
+            return fContact.forceStats(localPotential, potentials_[otherNodeIdOf(nodeId, fContact)]);
         }
 
+        // F1Contact::otherIndex() is an F1Node index, shared by all merged foundations.
         [[nodiscard]]
-        ContactStats contactStatsOf(F1Contact const& fContact, Real<u.potential> const localPotential) const {
-            return fContact.forceStats(localPotential, potentials_[fContact.otherIndex()]);
+        NodeIndex otherNodeIdOf(NodeIndex nodeId, F1Contact const& fContact) const {
+            Link const& link = fStructure_.structure().links()[fContact.linkIndex()];
+            return (link.localNodeId() == nodeId) ? link.otherNodeId() : link.localNodeId();
         }
     };
 }
@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
 #include <gustave/cfg/cLibConfig.hpp>
@@ -33,6 +34,7 @@
 #include <gustave/core/solvers/force1Solver/detail/ClusterNodeEvaluator.hpp>
 #include <gustave/core/solvers/force1Solver/detail/NodeBalancer.hpp>
 #include <gustave/core/solvers/force1Solver/detail/SolverRunContext.hpp>
+#include <gustave/utils/cExecutor.hpp>
 
 namespace gustave::core::solvers::force1Solver::detail {
     template<cfg::cLibConfig auto libCfg>
@@ -60,29 +62,35 @@ namespace gustave::core::solvers::force1Solver::detail {
             : ctx_{ ctx }
         {}
 
-        void runStep() {
+        void runStep(utils::cExecutor auto& executor) {
             auto const& lStructure = ctx_.lStructure;
             auto const& layers = lStructure.layers();
             auto& layerOffsets = ctx_.nextPotentials;
             assert(layerOffsets.size() >= layers.size());
             auto const balancer = NodeBalancer{ targetErrorFactor * ctx_.config().targetMaxError() };
-            for (LayerIndex layerId = 0; layerId < layers.size(); ++layerId) {
+            executor.parallelFor(layers.size(), [&](std::size_t layerId) {
                 auto const& layer = layers[layerId];
                 if (layer.isFoundation()) {
                     layerOffsets[layerId] = 0.f * u.potential;
                 } else {
+                    auto const evaluator = NodeEvaluator{ ctx_.potentials, lStructure.lowContactsOf(LayerIndex(layerId)), layer.cumulatedWeight() };
+                    auto const balanceResult = balancer.findBalanceOffset(evaluator, 0.f * u.potential);
+                    layerOffsets[layerId] = balanceResult.offset;
+                }
+            });
+            for (LayerIndex layerId = 0; layerId < layers.size(); ++layerId) {
+                auto const& layer = layers[layerId];
+                if (!layer.isFoundation()) {
                     auto const lowLayerId = layer.lowLayerId();
                     assert(lowLayerId >= 0);
                     assert(lowLayerId < layerId);
-                    auto const evaluator = NodeEvaluator{ ctx_.potentials, lStructure.lowContactsOf(layerId), layer.cumulatedWeight() };
-                    auto const balanceResult = balancer.findBalanceOffset(evaluator, 0.f * u.potential);
-                    layerOffsets[layerId] = layerOffsets[lowLayerId] + balanceResult.offset;
+                    layerOffsets[layerId] += layerOffsets[lowLayerId];
                 }
             }
             auto const& layerOfNode = ctx_.lStructure.layerOfNode();
-            for (std::size_t nodeId = 0; nodeId < ctx_.potentials.size(); ++nodeId) {
+            executor.parallelFor(ctx_.potentials.size(), [&](std::size_t nodeId) {
                 ctx_.potentials[nodeId] += layerOffsets[layerOfNode[nodeId]];
-            }
+            });
             ++ctx_.iterationIndex;
         }
     private:
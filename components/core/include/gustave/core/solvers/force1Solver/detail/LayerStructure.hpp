@@ -26,6 +26,7 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
 #include <vector>
 
 #include <gustave/cfg/cLibConfig.hpp>
@@ -100,9 +101,10 @@ namespace gustave::core::solvers::force1Solver::detail {
             auto ld = LayerDecomposition{ fStructure };
             reachedCount_ = ld.reachedCount;
 
-            LayerIndex const lastLayerId = ld.decLayers.size() - 1;
+            auto const lastLayerId = static_cast<LayerIndex>(ld.decLayers.size() - 1);
             layers_.reserve(ld.decLayers.size());
             lowContacts_.reserve(ld.lowContactsCount);
+            lowContactSources_.reserve(ld.lowContactsCount);
             ContactIndex startLowContact = 0;
             while (!ld.decLayers.empty()) {
                 auto& decLayer = ld.decLayers.back();
@@ -112,6 +114,7 @@ namespace gustave::core::solvers::force1Solver::detail {
                     for (auto const& fContact : fStructure.fContactsOf(nodeId)) {
                         if (ld.layerOfNode[fContact.otherIndex()] > decLayerId) {
                             lowContacts_.emplace_back(fContact.basicContact(), nodeId);
+                            lowContactSources_.push_back(fStructure.contactIdOf(fContact));
                             sizeLowContact += 1;
                         }
                     }
@@ -130,6 +133,58 @@ namespace gustave::core::solvers::force1Solver::detail {
             }
         }
 
+        // Same decomposition as `other`, for an F1Structure of the same topology: the weights and conductivities
+        // are read from fStructure. All nodes must have been reached (solvable structure).
+        [[nodiscard]]
+        explicit LayerStructure(LayerStructure const& other, F1Structure const& fStructure)
+            : reachedCount_{ other.reachedCount_ }
+            , layerOfNode_{ other.layerOfNode_ }
+            , lowContactSources_{ other.lowContactSources_ }
+        {
+            auto const& fNodes = fStructure.fNodes();
+            assert(layerOfNode_.size() == fNodes.size());
+            assert(reachedCount_ == fNodes.size());
+            std::vector<Real<u.force>> weights(other.layers_.size(), 0.f * u.force);
+            for (NodeIndex nodeId = 0; nodeId < fNodes.size(); ++nodeId) {
+                weights[layerOfNode_[nodeId]] += fNodes[nodeId].weight;
+            }
+            // The low layer of a layer has a lower index (or none: lowLayerId() >= layerId).
+            for (std::size_t layerId = weights.size(); layerId-- > 0;) {
+                LayerIndex const lowLayerId = other.layers_[layerId].lowLayerId();
+                if (lowLayerId < layerId) {
+                    weights[lowLayerId] += weights[layerId];
+                }
+            }
+            layers_.reserve(other.layers_.size());
+            for (std::size_t layerId = 0; layerId < other.layers_.size(); ++layerId) {
+                Layer const& layer = other.layers_[layerId];
+                layers_.emplace_back(layer.lowContactIds(), layer.lowLayerId(), weights[layerId]);
+            }
+            lowContacts_.reserve(other.lowContacts_.size());
+            for (std::size_t contactId = 0; contactId < other.lowContacts_.size(); ++contactId) {
+                auto const& fContact = fStructure.fContacts()[lowContactSources_[contactId]];
+                lowContacts_.emplace_back(fContact.basicContact(), other.lowContacts_[contactId].localIndex());
+            }
+        }
+
+        // Same decomposition as a LayerStructure of another precision, values converted by `convert`.
+        template<cfg::cLibConfig auto otherCfg>
+        [[nodiscard]]
+        explicit LayerStructure(LayerStructure<otherCfg> const& other, auto const& convert)
+            : reachedCount_{ other.reachedCount() }
+            , layerOfNode_( other.layerOfNode().begin(), other.layerOfNode().end() )
+            , lowContactSources_( other.lowContactSources().begin(), other.lowContactSources().end() )
+        {
+            layers_.reserve(other.layers().size());
+            for (auto const& layer : other.layers()) {
+                layers_.emplace_back(layer.lowContactIds(), layer.lowLayerId(), convert(layer.cumulatedWeight()));
+            }
+            lowContacts_.reserve(other.lowContacts().size());
+            for (auto const& contact : other.lowContacts()) {
+                lowContacts_.emplace_back(contact, convert);
+            }
+        }
+
         [[nodiscard]]
         std::vector<LayerIndex> const& layerOfNode() const {
             return layerOfNode_;
@@ -150,6 +205,21 @@ namespace gustave::core::solvers::force1Solver::detail {
             return layers_[nodeId].lowContactIds().subSpanOf(lowContacts_);
         }
 
+        // Index in F1Structure::fContacts() of each contact of lowContacts().
+        [[nodiscard]]
+        std::vector<ContactIndex> const& lowContactSources() const {
+            return lowContactSources_;
+        }
+
+        // Bytes allocated on the heap by this structure.
+        [[nodiscard]]
+        std::size_t memoryUsage() const {
+            return layers_.capacity() * sizeof(Layer)
+                + layerOfNode_.capacity() * sizeof(LayerIndex)
+                + lowContacts_.capacity() * sizeof(LayerContact)
+                + lowContactSources_.capacity() * sizeof(ContactIndex);
+        }
+
         [[nodiscard]]
         std::size_t reachedCount() const {
             return reachedCount_;
@@ -159,5 +229,6 @@ namespace gustave::core::solvers::force1Solver::detail {
         std::vector<Layer> layers_;
         std::vector<LayerIndex> layerOfNode_;
         std::vector<LayerContact> lowContacts_;
+        std::vector<ContactIndex> lowContactSources_;
     };
 }
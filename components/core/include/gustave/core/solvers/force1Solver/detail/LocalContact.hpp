@@ -54,6 +54,19 @@ namespace gustave::core::solvers::force1Solver::detail {
             assert(localIndex != fContact.otherIndex());
         }
 
+        // Copy of a contact of another precision, conductivities converted by `convert`.
+        template<cfg::cLibConfig auto otherCfg>
+        [[nodiscard]]
+        explicit LocalContact(LocalContact<otherCfg> const& other, auto const& convert)
+            : fContact_{ other.otherIndex(), convert(other.basicContact().cPlus()), convert(other.basicContact().cMinus()) }
+            , localIndex_{ other.localIndex() }
+        {}
+
+        [[nodiscard]]
+        F1BasicContact const& basicContact() const {
+            return fContact_;
+        }
+
         [[nodiscard]]
         ForceStats forceStats(Real<u.potential> sourcePotential, Real<u.potential> otherPotential) const {
             return fContact_.forceStats(sourcePotential, otherPotential);
@@ -0,0 +1,164 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cReal.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/solvers/force1Solver/detail/BasicStepRunner.hpp>
+#include <gustave/core/solvers/force1Solver/detail/ClusterStepRunner.hpp>
+#include <gustave/core/solvers/force1Solver/detail/LayerStepRunner.hpp>
+#include <gustave/core/solvers/force1Solver/detail/SolverRunContext.hpp>
+#include <gustave/core/solvers/Structure.hpp>
+#include <gustave/utils/cExecutor.hpp>
+
+namespace gustave::core::solvers::force1Solver::detail {
+    template<cfg::cLibConfig auto libCfg, cfg::cLibConfig auto lowCfg>
+    class LowPrecisionRunner {
+    private:
+        static constexpr auto u = cfg::units(libCfg);
+
+        template<cfg::cUnitOf<lowCfg> auto unit>
+        using LowReal = cfg::Real<lowCfg, unit>;
+
+        using LowRep = decltype(lowCfg)::RealRep;
+
+        using LowBasicStepRunner = detail::BasicStepRunner<lowCfg>;
+        using LowClusterStepRunner = detail::ClusterStepRunner<lowCfg>;
+        using LowLayerStepRunner = detail::LayerStepRunner<lowCfg>;
+        using LowRunContext = detail::SolverRunContext<lowCfg>;
+
+        using LowClusterStructure = LowRunContext::ClusterStructure;
+        using LowConfig = LowRunContext::Config;
+        using LowLayerStructure = LowRunContext::LayerStructure;
+        using LowStructure = solvers::Structure<lowCfg>;
+        using LowLink = LowStructure::Link;
+        using LowNode = LowStructure::Node;
+        using LowNormalizedVector3 = cfg::NormalizedVector3<lowCfg>;
+        using LowVector3 = cfg::Vector3<lowCfg, u.acceleration>;
+    public:
+        using SolverRunContext = detail::SolverRunContext<libCfg>;
+
+        using ClusterStructure = SolverRunContext::ClusterStructure;
+        using Config = SolverRunContext::Config;
+        using IterationIndex = SolverRunContext::IterationIndex;
+        using LayerStructure = SolverRunContext::LayerStructure;
+        using Structure = SolverRunContext::Structure;
+
+        // Number of basic steps without significant progress after which the low precision pass gives up.
+        static constexpr IterationIndex stallSteps = 16;
+        // Minimal relative decrease of the max error to be considered a significant progress.
+        static constexpr LowReal<u.one> stallFactor = 0.99f;
+
+        [[nodiscard]]
+        explicit LowPrecisionRunner(SolverRunContext& ctx)
+            : ctx_{ ctx }
+        {}
+
+        void run(utils::cExecutor auto& executor) {
+            LowStructure const lowStructure = lowerStructure(ctx_.fStructure.structure());
+            LowConfig const lowConfig = lowerConfig(ctx_.config());
+            LowRunContext lowCtx{ lowStructure, lowConfig, lowerLayers(ctx_.lStructure), lowerClusters(ctx_.cStructures) };
+            LowBasicStepRunner basicRunner{ lowCtx };
+            LowClusterStepRunner clusterRunner{ lowCtx };
+            LowLayerStepRunner layerRunner{ lowCtx };
+            LowReal<u.one> bestError = std::numeric_limits<LowRep>::infinity();
+            IterationIndex stepsWithoutProgress = 0;
+            while (lowCtx.iterationIndex < lowConfig.maxIterations() && stepsWithoutProgress < stallSteps) {
+                layerRunner.runStep(executor);
+                for (auto const& cStructure : lowCtx.cStructures) {
+                    clusterRunner.runStep(cStructure, executor);
+                }
+                auto const stepResult = basicRunner.runStep(executor);
+                if (stepResult.isBelowTargetError) {
+                    break;
+                }
+                LowReal<u.one> const stepError = stepResult.maxError;
+                if (stepError < stallFactor * bestError) {
+                    bestError = stepError;
+                    stepsWithoutProgress = 0;
+                } else {
+                    ++stepsWithoutProgress;
+                }
+            }
+            for (std::size_t nodeId = 0; nodeId < ctx_.potentials.size(); ++nodeId) {
+                ctx_.potentials[nodeId] = lowCtx.potentials[nodeId];
+            }
+            ctx_.iterationIndex = lowCtx.iterationIndex;
+        }
+    private:
+        [[nodiscard]]
+        static auto lower(cfg::cReal auto value) {
+            return static_cast<LowRep>(value.value()) * value.unit();
+        }
+
+        static constexpr auto lowerFn = [](cfg::cReal auto value) { return lower(value); };
+
+        [[nodiscard]]
+        static std::vector<LowClusterStructure> lowerClusters(std::vector<ClusterStructure> const& cStructures) {
+            std::vector<LowClusterStructure> result;
+            result.reserve(cStructures.size());
+            for (auto const& cStructure : cStructures) {
+                result.emplace_back(cStructure, lowerFn);
+            }
+            return result;
+        }
+
+        [[nodiscard]]
+        static LowConfig lowerConfig(Config const& config) {
+            auto const& g = config.g();
+            return LowConfig{ LowVector3{ lower(g.x()), lower(g.y()), lower(g.z()) }, lower(config.targetMaxError()), config.maxIterations() };
+        }
+
+        [[nodiscard]]
+        static LowLayerStructure lowerLayers(LayerStructure const& lStructure) {
+            return LowLayerStructure{ lStructure, lowerFn };
+        }
+
+        [[nodiscard]]
+        static LowStructure lowerStructure(Structure const& structure) {
+            LowStructure result;
+            for (auto const& node : structure.nodes()) {
+                result.addNode(LowNode{ lower(node.mass()), node.isFoundation });
+            }
+            for (auto const& link : structure.links()) {
+                auto const& normal = link.normal();
+                auto const& conductivity = link.conductivity();
+                auto const lowNormal = LowNormalizedVector3{ lower(normal.x()), lower(normal.y()), lower(normal.z()) };
+                auto const lowConductivity = typename LowLink::Conductivity{ lower(conductivity.compression()), lower(conductivity.shear()), lower(conductivity.tensile()) };
+                result.addLink(LowLink{ link.localNodeId(), link.otherNodeId(), lowNormal, lowConductivity });
+            }
+            return result;
+        }
+
+        SolverRunContext& ctx_;
+    };
+}
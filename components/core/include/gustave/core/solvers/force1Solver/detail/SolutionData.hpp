@@ -26,53 +26,169 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
 #include <memory>
 #include <utility>
+#include <variant>
 
 #include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/solvers/force1Solver/detail/CompactRepartition.hpp>
 #include <gustave/core/solvers/force1Solver/detail/F1Structure.hpp>
 #include <gustave/core/solvers/force1Solver/detail/ForceRepartition.hpp>
 #include <gustave/core/solvers/force1Solver/SolutionBasis.hpp>
 
 namespace gustave::core::solvers::force1Solver::detail {
+    // Keeps the F1Structure, or a CompactRepartition if the config asks for compact solutions.
     template<cfg::cLibConfig auto libCfg>
     class SolutionData {
+    private:
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
+
+        using NodeIndex = cfg::NodeIndex<libCfg>;
+        using NormalizedVector3 = cfg::NormalizedVector3<libCfg>;
+
+        static constexpr auto u = cfg::units(libCfg);
     public:
         using Basis = SolutionBasis<libCfg>;
+        using CompactRepartition = detail::CompactRepartition<libCfg>;
         using F1Structure = detail::F1Structure<libCfg>;
         using ForceRepartition = detail::ForceRepartition<libCfg>;
 
+        using ContactIndex = Basis::Structure::ContactIndex;
+        using LinkIndex = cfg::LinkIndex<libCfg>;
+
         [[nodiscard]]
         explicit SolutionData(std::shared_ptr<const Basis>&& basis)
             : basis_{ std::move(basis) }
-            , fStructure_{ basis_->structure(), basis_->config() }
+            , normalizedG_{ basis_->config().g() }
+            , repartition_{ makeRepartition(F1Structure{ basis_->structure(), basis_->config(), basis_->extraMasses() }) }
         {}
 
         [[nodiscard]]
         explicit SolutionData(std::shared_ptr<const Basis>&& basis, F1Structure&& balancer)
             : basis_{ std::move(basis) }
-            , fStructure_{ std::move(balancer) }
-        {
-            assert(&basis_->structure() == &fStructure_.structure());
-            assert(&basis_->config() == &fStructure_.config());
-        }
+            , normalizedG_{ basis_->config().g() }
+            , repartition_{ makeRepartition(std::move(balancer)) }
+        {}
 
         [[nodiscard]]
         Basis const& basis() const {
             return *basis_;
         }
 
+        [[nodiscard]]
+        std::shared_ptr<Basis const> const& basisPtr() const {
+            return basis_;
+        }
+
+        [[nodiscard]]
+        std::size_t contactCountOf(NodeIndex nodeId) const {
+            if (auto const* compact = compactRepartition()) {
+                return compact->linkIdsOf(nodeId).size();
+            }
+            return fStructure().nodeContactsOf(nodeId).size();
+        }
+
+        [[nodiscard]]
+        Real<u.force> forceCoord(NodeIndex to, NodeIndex from) const {
+            if (auto const* compact = compactRepartition()) {
+                return compact->forceCoord(to, from);
+            }
+            return forceRepartition().forceCoord(to, from);
+        }
+
+        [[nodiscard]]
+        Real<u.force> forceCoordOnContact(ContactIndex const& index) const {
+            if (auto const* compact = compactRepartition()) {
+                return compact->forceCoordOnContact(index);
+            }
+            return forceRepartition().forceCoordOnContact(index);
+        }
+
+        [[nodiscard]]
+        bool isCompact() const {
+            return compactRepartition() != nullptr;
+        }
+
+        // Link of the i-th contact of a node.
+        [[nodiscard]]
+        LinkIndex linkIdOf(NodeIndex nodeId, std::size_t localContactId) const {
+            if (auto const* compact = compactRepartition()) {
+                return compact->linkIdsOf(nodeId)[localContactId];
+            }
+            return fStructure().nodeContactsOf(nodeId)[localContactId].linkIndex();
+        }
+
+        [[nodiscard]]
+        Real<u.one> maxRelativeError() const {
+            if (auto const* compact = compactRepartition()) {
+                return compact->maxRelativeError();
+            }
+            return forceRepartition().maxRelativeError();
+        }
+
+        // Bytes allocated on the heap, the basis excluded.
+        [[nodiscard]]
+        std::size_t memoryUsage() const {
+            if (auto const* compact = compactRepartition()) {
+                return compact->memoryUsage();
+            }
+            return fStructure().memoryUsage();
+        }
+
+        [[nodiscard]]
+        Real<u.force> netForceCoord(NodeIndex nodeId) const {
+            if (auto const* compact = compactRepartition()) {
+                return compact->netForceCoord(nodeId);
+            }
+            return forceRepartition().statsOf(nodeId).force();
+        }
+
+        [[nodiscard]]
+        NormalizedVector3 const& normalizedG() const {
+            return normalizedG_;
+        }
+
+        [[nodiscard]]
+        Real<u.one> relativeErrorOf(NodeIndex nodeId) const {
+            if (auto const* compact = compactRepartition()) {
+                return compact->relativeErrorOf(nodeId);
+            }
+            return forceRepartition().relativeErrorOf(nodeId);
+        }
+    private:
+        using Repartition = std::variant<F1Structure, CompactRepartition>;
+
+        [[nodiscard]]
+        CompactRepartition const* compactRepartition() const {
+            return std::get_if<CompactRepartition>(&repartition_);
+        }
+
         [[nodiscard]]
         F1Structure const& fStructure() const {
-            return fStructure_;
+            return std::get<F1Structure>(repartition_);
         }
 
         [[nodiscard]]
         ForceRepartition forceRepartition() const {
-            return ForceRepartition{ fStructure_, basis_->potentials() };
+            return ForceRepartition{ fStructure(), basis_->potentials() };
         }
-    private:
+
+        [[nodiscard]]
+        Repartition makeRepartition(F1Structure&& fStructure) const {
+            assert(&basis_->structure() == &fStructure.structure());
+            assert(&basis_->config() == &fStructure.config());
+            if (basis_->config().compactSolutions()) {
+                return Repartition{ std::in_place_type<CompactRepartition>, fStructure, basis_->potentials() };
+            }
+            return Repartition{ std::in_place_type<F1Structure>, std::move(fStructure) };
+        }
+
         std::shared_ptr<Basis const> basis_;
-        F1Structure fStructure_;
+        NormalizedVector3 normalizedG_;
+        Repartition repartition_;
     };
 }
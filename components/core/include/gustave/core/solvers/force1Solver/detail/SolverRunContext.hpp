@@ -26,6 +26,7 @@
 #pragma once
 
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 #include <gustave/cfg/cLibConfig.hpp>
@@ -35,6 +36,7 @@
 #include <gustave/core/solvers/force1Solver/detail/F1Structure.hpp>
 #include <gustave/core/solvers/force1Solver/detail/LayerStructure.hpp>
 #include <gustave/core/solvers/force1Solver/Config.hpp>
+#include <gustave/core/solvers/force1Solver/Decomposition.hpp>
 #include <gustave/core/solvers/Structure.hpp>
 
 namespace gustave::core::solvers::force1Solver::detail {
@@ -50,6 +52,7 @@ namespace gustave::core::solvers::force1Solver::detail {
     public:
         using ClusterStructure = detail::ClusterStructure<libCfg>;
         using Config = force1Solver::Config<libCfg>;
+        using Decomposition = force1Solver::Decomposition<libCfg>;
         using F1Structure = detail::F1Structure<libCfg>;
         using IterationIndex = std::uint64_t;
         using LayerStructure = detail::LayerStructure<libCfg>;
@@ -61,8 +64,30 @@ namespace gustave::core::solvers::force1Solver::detail {
             , lStructure{ fStructure }
             , cStructures{ initClusterStuctures(fStructure) }
             , iterationIndex{ 0 }
-            , potentials(structure.nodes().size(), 0.f * u.potential)
-            , nextPotentials(structure.nodes().size(), 0.f * u.potential)
+            , potentials(fStructure.fNodes().size(), 0.f * u.potential)
+            , nextPotentials(fStructure.fNodes().size(), 0.f * u.potential)
+        {}
+
+        // Context reusing decompositions already computed for the same structure.
+        [[nodiscard]]
+        explicit SolverRunContext(Structure const& structure, Config const& config, LayerStructure&& layers, std::vector<ClusterStructure>&& clusters)
+            : fStructure{ structure, config }
+            , lStructure{ std::move(layers) }
+            , cStructures{ std::move(clusters) }
+            , iterationIndex{ 0 }
+            , potentials(fStructure.fNodes().size(), 0.f * u.potential)
+            , nextPotentials(fStructure.fNodes().size(), 0.f * u.potential)
+        {}
+
+        // Context reusing the decomposition of a structure of the same topology, with updated weights & conductivities.
+        [[nodiscard]]
+        explicit SolverRunContext(Structure const& structure, Config const& config, Decomposition const& decomposition)
+            : fStructure{ structure, config }
+            , lStructure{ decomposition.layers(), fStructure }
+            , cStructures{ refreshClusterStructures(decomposition.clusters(), fStructure) }
+            , iterationIndex{ 0 }
+            , potentials(fStructure.fNodes().size(), 0.f * u.potential)
+            , nextPotentials(fStructure.fNodes().size(), 0.f * u.potential)
         {}
 
         [[nodiscard]]
@@ -76,7 +101,7 @@ namespace gustave::core::solvers::force1Solver::detail {
         IterationIndex iterationIndex;
         std::vector<Real<u.potential>> potentials;
         std::vector<Real<u.potential>> nextPotentials;
-    private:
+
         [[nodiscard]]
         static std::vector<ClusterStructure> initClusterStuctures(F1Structure const& fStructure) {
             static constexpr auto maxWidth = std::numeric_limits<NodeIndex>::max() / 2;
@@ -90,5 +115,15 @@ namespace gustave::core::solvers::force1Solver::detail {
             }
             return result;
         }
+
+        [[nodiscard]]
+        static std::vector<ClusterStructure> refreshClusterStructures(std::vector<ClusterStructure> const& clusters, F1Structure const& fStructure) {
+            std::vector<ClusterStructure> result;
+            result.reserve(clusters.size());
+            for (auto const& cStructure : clusters) {
+                result.emplace_back(cStructure, fStructure);
+            }
+            return result;
+        }
     };
 }
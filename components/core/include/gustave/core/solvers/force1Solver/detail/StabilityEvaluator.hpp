@@ -0,0 +1,128 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <span>
+#include <vector>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/model/Stress.hpp>
+#include <gustave/core/solvers/force1Solver/detail/ForceRepartition.hpp>
+#include <gustave/core/solvers/force1Solver/detail/SolverRunContext.hpp>
+#include <gustave/core/solvers/force1Solver/LinkStability.hpp>
+
+namespace gustave::core::solvers::force1Solver::detail {
+    template<cfg::cLibConfig auto libCfg>
+    class StabilityEvaluator {
+    private:
+        static constexpr auto u = cfg::units(libCfg);
+        static constexpr auto rt = libCfg.realTraits;
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
+
+        using LinkIndex = cfg::LinkIndex<libCfg>;
+        using NodeIndex = cfg::NodeIndex<libCfg>;
+        using NormalizedVector3 = cfg::NormalizedVector3<libCfg>;
+
+        using ForceRepartition = detail::ForceRepartition<libCfg>;
+    public:
+        using ForceStress = model::ForceStress<libCfg>;
+        using LinkStability = force1Solver::LinkStability<libCfg>;
+        using SolverRunContext = detail::SolverRunContext<libCfg>;
+        using StressRatio = model::StressRatio<libCfg>;
+        using Verdict = LinkStability::Verdict;
+
+        using ContactIndex = SolverRunContext::Structure::ContactIndex;
+
+        [[nodiscard]]
+        explicit StabilityEvaluator(SolverRunContext const& ctx, std::span<ForceStress const> maxForceStresses)
+            : ctx_{ ctx }
+            , maxForceStresses_{ maxForceStresses }
+        {
+            assert(maxForceStresses_.size() == ctx_.fStructure.structure().links().size());
+        }
+
+        // Returns true if every link has a definitive verdict.
+        bool evaluate(std::vector<LinkStability>& output) const {
+            auto const potentials = ctx_.fStructure.potentialsOf(ctx_.potentials);
+            auto const repartition = ForceRepartition{ ctx_.fStructure, potentials };
+            Real<u.force> const forceBound = totalResidualOf(repartition);
+            auto const& links = ctx_.fStructure.structure().links();
+            auto const& normalizedG = ctx_.fStructure.normalizedG();
+            bool result = true;
+            output.clear();
+            for (LinkIndex linkId = 0; linkId < links.size(); ++linkId) {
+                Real<u.force> const force = repartition.forceCoordOnContact(ContactIndex{ linkId, true });
+                Real<u.one> const nComp = links[linkId].normal().dot(normalizedG);
+                Real<u.one> const tComp = rt.sqrt(1.f - nComp * nComp);
+                Real<u.force> const normalForce = force * nComp;
+                Real<u.force> compression = 0.f * u.force;
+                Real<u.force> tensile = 0.f * u.force;
+                if (normalForce < 0.f * u.force) {
+                    compression = -normalForce;
+                } else {
+                    tensile = normalForce;
+                }
+                ForceStress const& maxForce = maxForceStresses_[linkId];
+                Real<u.force> const normalBound = forceBound * rt.abs(nComp);
+                auto const ratio = StressRatio{
+                    compression / maxForce.compression(),
+                    rt.abs(force) * tComp / maxForce.shear(),
+                    tensile / maxForce.tensile(),
+                };
+                auto const bound = StressRatio{
+                    normalBound / maxForce.compression(),
+                    forceBound * tComp / maxForce.shear(),
+                    normalBound / maxForce.tensile(),
+                };
+                output.emplace_back(ratio, bound);
+                if (output.back().verdict() == Verdict::Undecided) {
+                    result = false;
+                }
+            }
+            return result;
+        }
+    private:
+        [[nodiscard]]
+        Real<u.force> totalResidualOf(ForceRepartition const& repartition) const {
+            Real<u.force> result = 0.f * u.force;
+            auto const& nodes = ctx_.fStructure.structure().nodes();
+            for (NodeIndex nodeId = 0; nodeId < nodes.size(); ++nodeId) {
+                if (!nodes[nodeId].isFoundation) {
+                    result += rt.abs(repartition.statsOf(nodeId).force());
+                }
+            }
+            return result;
+        }
+
+        SolverRunContext const& ctx_;
+        std::span<ForceStress const> maxForceStresses_;
+    };
+}
@@ -0,0 +1,87 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/solvers/force1Solver/detail/F1Structure.hpp>
+
+namespace gustave::core::solvers::force1Solver::detail {
+    template<cfg::cLibConfig auto libCfg>
+    struct SubdomainDecomposition {
+    public:
+        using F1Structure = detail::F1Structure<libCfg>;
+        using NodeIndex = cfg::NodeIndex<libCfg>;
+        using SubdomainIndex = cfg::NodeIndex<libCfg>;
+
+        [[nodiscard]]
+        static constexpr SubdomainIndex invalidSubdomainId() {
+            return std::numeric_limits<SubdomainIndex>::max();
+        }
+
+        // Grows connected subdomains of at most maxSize non-foundation nodes by breadth-first search.
+        [[nodiscard]]
+        explicit SubdomainDecomposition(F1Structure const& fStructure, std::size_t maxSize)
+            : subdomainOfNode(fStructure.fNodes().size(), invalidSubdomainId())
+        {
+            assert(maxSize > 0);
+            auto const& fNodes = fStructure.fNodes();
+            std::vector<NodeIndex> frontier;
+            for (NodeIndex seedId = 0; seedId < fNodes.size(); ++seedId) {
+                if (fNodes[seedId].isFoundation || subdomainOfNode[seedId] != invalidSubdomainId()) {
+                    continue;
+                }
+                auto const subdomainId = static_cast<SubdomainIndex>(subdomains.size());
+                std::vector<NodeIndex>& subdomain = subdomains.emplace_back();
+                frontier.clear();
+                frontier.push_back(seedId);
+                subdomainOfNode[seedId] = subdomainId;
+                for (std::size_t frontierId = 0; frontierId < frontier.size() && subdomain.size() < maxSize; ++frontierId) {
+                    NodeIndex const nodeId = frontier[frontierId];
+                    subdomain.push_back(nodeId);
+                    for (auto const& fContact : fStructure.fContactsOf(nodeId)) {
+                        NodeIndex const otherId = fContact.otherIndex();
+                        if (!fNodes[otherId].isFoundation && subdomainOfNode[otherId] == invalidSubdomainId()) {
+                            subdomainOfNode[otherId] = subdomainId;
+                            frontier.push_back(otherId);
+                        }
+                    }
+                }
+                for (std::size_t frontierId = subdomain.size(); frontierId < frontier.size(); ++frontierId) {
+                    subdomainOfNode[frontier[frontierId]] = invalidSubdomainId();
+                }
+            }
+        }
+
+        std::vector<SubdomainIndex> subdomainOfNode;
+        std::vector<std::vector<NodeIndex>> subdomains;
+    };
+}
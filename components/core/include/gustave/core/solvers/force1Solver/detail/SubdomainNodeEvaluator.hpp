@@ -0,0 +1,93 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <span>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/solvers/force1Solver/detail/f1Structure/F1Contact.hpp>
+#include <gustave/core/solvers/force1Solver/detail/NodePoint.hpp>
+
+namespace gustave::core::solvers::force1Solver::detail {
+    // Evaluates a node against the in-progress potentials of its own subdomain, and the fixed potentials of the other nodes.
+    template<cfg::cLibConfig auto libCfg_>
+    class SubdomainNodeEvaluator {
+    private:
+        template<cfg::cUnitOf<libCfg_> auto unit>
+        using Real = cfg::Real<libCfg_, unit>;
+
+        static constexpr auto u = cfg::units(libCfg_);
+    public:
+        using F1Contact = f1Structure::F1Contact<libCfg_>;
+        using NodeIndex = cfg::NodeIndex<libCfg_>;
+        using NodePoint = detail::NodePoint<libCfg_>;
+        using SubdomainIndex = cfg::NodeIndex<libCfg_>;
+
+        using Contacts = std::span<F1Contact const>;
+        using Potentials = std::span<Real<u.potential> const>;
+        using SubdomainOfNode = std::span<SubdomainIndex const>;
+
+        [[nodiscard]]
+        explicit SubdomainNodeEvaluator(Potentials const& fixedPotentials, Potentials const& localPotentials, SubdomainOfNode const& subdomainOfNode,
+            SubdomainIndex subdomainId, Contacts const& contacts, Real<u.force> weight)
+            : fixedPotentials_{ fixedPotentials }
+            , localPotentials_{ localPotentials }
+            , subdomainOfNode_{ subdomainOfNode }
+            , subdomainId_{ subdomainId }
+            , contacts_{ contacts }
+            , weight_{ weight }
+        {}
+
+        [[nodiscard]]
+        NodePoint pointAt(Real<u.potential> const offset) const {
+            Real<u.force> force = weight_;
+            Real<u.conductivity> conductivity = 0.f * u.conductivity;
+            for (auto const& contact : contacts_) {
+                NodeIndex const otherIndex = contact.otherIndex();
+                bool const isLocal = (subdomainOfNode_[otherIndex] == subdomainId_);
+                Real<u.potential> const otherPotential = isLocal ? localPotentials_[otherIndex] : fixedPotentials_[otherIndex];
+                auto const forceStats = contact.forceStats(offset, otherPotential);
+                conductivity += forceStats.conductivity;
+                force += forceStats.force();
+            }
+            return NodePoint{ offset, force, conductivity };
+        }
+
+        [[nodiscard]]
+        Real<u.force> weight() const {
+            return weight_;
+        }
+    private:
+        Potentials fixedPotentials_;
+        Potentials localPotentials_;
+        SubdomainOfNode subdomainOfNode_;
+        SubdomainIndex subdomainId_;
+        Contacts contacts_;
+        Real<u.force> weight_;
+    };
+}
@@ -0,0 +1,111 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/solvers/force1Solver/detail/NodeBalancer.hpp>
+#include <gustave/core/solvers/force1Solver/detail/SolverRunContext.hpp>
+#include <gustave/core/solvers/force1Solver/detail/SubdomainDecomposition.hpp>
+#include <gustave/core/solvers/force1Solver/detail/SubdomainNodeEvaluator.hpp>
+#include <gustave/utils/cExecutor.hpp>
+
+namespace gustave::core::solvers::force1Solver::detail {
+    // Additive Schwarz step: each subdomain is relaxed with Gauss-Seidel sweeps while the potentials
+    // of the nodes outside of it stay fixed. Subdomains only write their own nodes, so they run in parallel.
+    template<cfg::cLibConfig auto libCfg>
+    class SubdomainStepRunner {
+    private:
+        static constexpr auto u = cfg::units(libCfg);
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
+
+        using NodeIndex = cfg::NodeIndex<libCfg>;
+
+        using SolverRunContext = detail::SolverRunContext<libCfg>;
+        using SubdomainDecomposition = detail::SubdomainDecomposition<libCfg>;
+
+        using NodeBalancer = detail::NodeBalancer<libCfg>;
+        using NodeEvaluator = detail::SubdomainNodeEvaluator<libCfg>;
+        using SubdomainIndex = SubdomainDecomposition::SubdomainIndex;
+    public:
+        static constexpr unsigned sweepCount = 4;
+        static constexpr Real<u.one> targetErrorFactor = 0.75f;
+
+        [[nodiscard]]
+        explicit SubdomainStepRunner(SolverRunContext& ctx, std::size_t subdomainSize)
+            : ctx_{ ctx }
+            , decomposition_{ std::make_shared<SubdomainDecomposition const>(ctx.fStructure, subdomainSize) }
+        {}
+
+        // Reuses a decomposition of a structure of the same topology.
+        [[nodiscard]]
+        explicit SubdomainStepRunner(SolverRunContext& ctx, std::shared_ptr<SubdomainDecomposition const> decomposition)
+            : ctx_{ ctx }
+            , decomposition_{ std::move(decomposition) }
+        {
+            assert(decomposition_->subdomainOfNode.size() == ctx.fStructure.fNodes().size());
+        }
+
+        void runStep(utils::cExecutor auto& executor) {
+            auto const& fNodes = ctx_.fStructure.fNodes();
+            auto const balancer = NodeBalancer{ targetErrorFactor * ctx_.config().targetMaxError() };
+            auto& localPotentials = ctx_.nextPotentials;
+            localPotentials = ctx_.potentials;
+            executor.parallelFor(decomposition_->subdomains.size(), [&](std::size_t subdomainId) {
+                for (unsigned sweepId = 0; sweepId < sweepCount; ++sweepId) {
+                    for (NodeIndex const nodeId : decomposition_->subdomains[subdomainId]) {
+                        auto const evaluator = NodeEvaluator{ ctx_.potentials, localPotentials, decomposition_->subdomainOfNode,
+                            SubdomainIndex(subdomainId), ctx_.fStructure.fContactsOf(nodeId), fNodes[nodeId].weight };
+                        localPotentials[nodeId] = balancer.findBalanceOffset(evaluator, localPotentials[nodeId]).offset;
+                    }
+                }
+            });
+            ctx_.potentials.swap(localPotentials);
+            ++ctx_.iterationIndex;
+        }
+
+        [[nodiscard]]
+        SubdomainDecomposition const& decomposition() const {
+            return *decomposition_;
+        }
+
+        [[nodiscard]]
+        std::shared_ptr<SubdomainDecomposition const> const& decompositionPtr() const {
+            return decomposition_;
+        }
+    private:
+        SolverRunContext& ctx_;
+        std::shared_ptr<SubdomainDecomposition const> decomposition_;
+    };
+}
@@ -79,12 +79,12 @@ namespace gustave::core::solvers::force1Solver::solution {
 
         [[nodiscard]]
         Real<u.force> forceCoord() const {
-            return solution_->forceRepartition().forceCoordOnContact(index_);
+            return solution_->forceCoordOnContact(index_);
         }
 
         [[nodiscard]]
         Vector3<u.force> forceVector() const {
-            return solution_->forceRepartition().forceVectorOnContact(index_);
+            return forceCoord() * solution_->normalizedG();
         }
 
         [[nodiscard]]
@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <sstream>
 
 #include <gustave/cfg/cLibConfig.hpp>
@@ -46,10 +47,7 @@ namespace gustave::core::solvers::force1Solver::solution {
         using SolutionData = detail::SolutionData<libCfg>;
         using Structure = solvers::Structure<libCfg>;
 
-        using F1LocalContacts = SolutionData::F1Structure::LocalContacts;
-        using F1Node = SolutionData::F1Structure::F1Node;
         using LinkIndex = cfg::LinkIndex<libCfg>;
-        using NodeStats = SolutionData::ForceRepartition::NodeStats;
         using StructureNode = Structure::Node;
         using StructureLink = Structure::Link;
         using StructureLinks = Structure::Links;
@@ -70,20 +68,18 @@ namespace gustave::core::solvers::force1Solver::solution {
         class Contacts {
         private:
             class Enumerator {
-            private:
-                using DataIterator = F1LocalContacts::iterator;
             public:
                 [[nodiscard]]
                 Enumerator()
                     : contacts_{ nullptr }
-                    , dataIterator_{}
+                    , localContactId_{ 0 }
                     , value_{ utils::NO_INIT }
                 {}
 
                 [[nodiscard]]
                 explicit Enumerator(Contacts const& contacts)
                     : contacts_{ &contacts }
-                    , dataIterator_{ contacts.fLocalContacts_.begin() }
+                    , localContactId_{ 0 }
                     , value_{ utils::NO_INIT }
                 {
                     updateValue();
@@ -91,11 +87,11 @@ namespace gustave::core::solvers::force1Solver::solution {
 
                 [[nodiscard]]
                 bool isEnd() const {
-                    return dataIterator_ == contacts_->fLocalContacts_.end();
+                    return localContactId_ == contacts_->size_;
                 }
 
                 void operator++() {
-                    ++dataIterator_;
+                    ++localContactId_;
                     updateValue();
                 }
 
@@ -106,20 +102,21 @@ namespace gustave::core::solvers::force1Solver::solution {
 
                 [[nodiscard]]
                 bool operator==(Enumerator const& other) const {
-                    return dataIterator_ == other.dataIterator_;
+                    return localContactId_ == other.localContactId_;
                 }
             private:
                 void updateValue() {
                     if (!isEnd()) {
-                        LinkIndex linkId = dataIterator_->linkIndex();
+                        NodeReference const& node = contacts_->node_;
+                        LinkIndex linkId = node.solution_->linkIdOf(node.index_, localContactId_);
                         StructureLink const& link = (*contacts_->links_)[linkId];
-                        bool isOnLocalNode = (link.localNodeId() == contacts_->node_.index_);
-                        value_ = ContactReference{ *contacts_->node_.solution_, ContactIndex{ linkId, isOnLocalNode } };
+                        bool isOnLocalNode = (link.localNodeId() == node.index_);
+                        value_ = ContactReference{ *node.solution_, ContactIndex{ linkId, isOnLocalNode } };
                     }
                 }
 
                 Contacts const* contacts_;
-                DataIterator dataIterator_;
+                std::size_t localContactId_;
                 ContactReference value_;
             };
         public:
@@ -129,7 +126,7 @@ namespace gustave::core::solvers::force1Solver::solution {
             explicit Contacts(NodeReference const& node)
                 : node_{ node }
                 , links_{ &node_.solution_->basis().structure().links() }
-                , fLocalContacts_{ node.fLocalContacts() }
+                , size_{ node_.solution_->contactCountOf(node_.index_) }
             {}
 
             [[nodiscard]]
@@ -162,12 +159,12 @@ namespace gustave::core::solvers::force1Solver::solution {
 
             [[nodiscard]]
             std::size_t size() const {
-                return fLocalContacts_.size();
+                return size_;
             }
         private:
             NodeReference node_;
             StructureLinks const* links_;
-            F1LocalContacts fLocalContacts_;
+            std::size_t size_;
         };
 
         [[nodiscard]]
@@ -189,7 +186,7 @@ namespace gustave::core::solvers::force1Solver::solution {
 
         [[nodiscard]]
         Vector3<u.force> forceVectorFrom(NodeIndex otherNodeId) const {
-            return solution_->forceRepartition().forceVector(index_, otherNodeId);
+            return solution_->forceCoord(index_, otherNodeId) * solution_->normalizedG();
         }
 
         [[nodiscard]]
@@ -204,17 +201,17 @@ namespace gustave::core::solvers::force1Solver::solution {
 
         [[nodiscard]]
         Real<u.mass> mass() const {
-            return structureNode().mass();
+            return solution_->basis().massOf(index_);
         }
 
         [[nodiscard]]
         Real<u.force> netForceCoord() const {
-            return stats().force();
+            return solution_->netForceCoord(index_);
         }
 
         [[nodiscard]]
         Vector3<u.force> netForceVector() const {
-            return stats().force() * solution_->fStructure().normalizedG();
+            return netForceCoord() * solution_->normalizedG();
         }
 
         [[nodiscard]]
@@ -224,42 +221,27 @@ namespace gustave::core::solvers::force1Solver::solution {
 
         [[nodiscard]]
         Real<u.one> relativeError() const {
-            return solution_->forceRepartition().relativeErrorOf(index_);
+            return solution_->relativeErrorOf(index_);
         }
 
         [[nodiscard]]
         Real<u.force> weight() const {
-            return fNode().weight;
+            return solution_->basis().config().g().norm() * mass();
         }
 
         [[nodiscard]]
         Vector3<u.force> weightVector() const {
-            return fNode().weight * solution_->fStructure().normalizedG();
+            return weight() * solution_->normalizedG();
         }
 
         [[nodiscard]]
         bool operator==(NodeReference const&) const = default;
     private:
-        [[nodiscard]]
-        F1Node const& fNode() const {
-            return solution_->fStructure().fNodes()[index_];
-        }
-
-        [[nodiscard]]
-        F1LocalContacts fLocalContacts() const {
-            return solution_->fStructure().fContactsOf(index_);
-        }
-
         [[nodiscard]]
         StructureNode const& structureNode() const {
             return solution_->basis().structure().nodes()[index_];
         }
 
-        [[nodiscard]]
-        NodeStats stats() const {
-            return solution_->forceRepartition().statsOf(index_);
-        }
-
         SolutionData const* solution_;
         NodeIndex index_;
     };
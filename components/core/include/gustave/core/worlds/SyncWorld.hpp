@@ -26,18 +26,27 @@
 #pragma once
 
 #include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <memory>
 #include <optional>
 #include <utility>
 
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/cfg/cUnitOf.hpp>
 #include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/worlds/syncWorld/detail/SnapshotBuilder.hpp>
 #include <gustave/core/worlds/syncWorld/detail/WorldData.hpp>
 #include <gustave/core/worlds/syncWorld/detail/WorldUpdater.hpp>
 #include <gustave/core/worlds/syncWorld/Blocks.hpp>
+#include <gustave/core/worlds/syncWorld/ChangeRecord.hpp>
 #include <gustave/core/worlds/syncWorld/Contacts.hpp>
+#include <gustave/core/worlds/syncWorld/ContactView.hpp>
 #include <gustave/core/worlds/syncWorld/Links.hpp>
+#include <gustave/core/worlds/syncWorld/SolveMode.hpp>
 #include <gustave/core/worlds/syncWorld/Structures.hpp>
+#include <gustave/core/worlds/syncWorld/WorldSnapshot.hpp>
+#include <gustave/utils/cExecutor.hpp>
 
 namespace gustave::core::worlds {
     template<cfg::cLibConfig auto libCfg>
@@ -51,6 +60,7 @@ namespace gustave::core::worlds {
         template<cfg::cUnitOf<libCfg> auto unit>
         using Vector3 = cfg::Vector3<libCfg, unit>;
 
+        using SnapshotBuilder = syncWorld::detail::SnapshotBuilder<libCfg>;
         using WorldData = syncWorld::detail::WorldData<libCfg>;
         using WorldUpdater = syncWorld::detail::WorldUpdater<libCfg>;
     public:
@@ -61,11 +71,20 @@ namespace gustave::core::worlds {
 
         using BlockIndex = WorldData::Scene::BlockIndex;
         using BlockReference = Blocks::BlockReference;
+        using BlockRegion = Blocks::BlockRegion;
+        using BlockView = WorldData::Scene::BlockView;
+        using ChangeRecord = syncWorld::ChangeRecord<libCfg>;
         using ContactIndex = Contacts::ContactIndex;
         using ContactReference = Contacts::ContactReference;
+        using ContactView = syncWorld::ContactView<libCfg>;
         using Scene = WorldData::Scene;
+        using Snapshot = syncWorld::WorldSnapshot<libCfg>;
+        using SolveMode = syncWorld::SolveMode;
         using Solver = WorldData::Solver;
+        using StructureIndex = WorldData::Scene::StructureIndex;
         using StructureReference = Structures::StructureReference;
+        using StructureStats = StructureReference::StructureStats;
+        using Terrain = WorldData::Terrain;
         using Transaction = WorldData::Scene::Transaction;
         using TransactionResult = WorldData::Scene::TransactionResult;
 
@@ -74,6 +93,11 @@ namespace gustave::core::worlds {
             : data_{ blockSize, std::move(solver) }
         {}
 
+        [[nodiscard]]
+        explicit SyncWorld(Vector3<u.length> const& blockSize, Terrain terrain, Solver solver)
+            : data_{ blockSize, std::move(terrain), std::move(solver) }
+        {}
+
         SyncWorld(SyncWorld const&) = delete;
         SyncWorld& operator=(SyncWorld const&) = delete;
 
@@ -105,11 +129,94 @@ namespace gustave::core::worlds {
             return WorldUpdater{ data_ }.runTransaction(transaction);
         }
 
+        TransactionResult modify(Transaction const& transaction, utils::cExecutor auto& executor) {
+            return WorldUpdater{ data_ }.runTransaction(transaction, executor);
+        }
+
+        // changes: cleared, then filled with the blocks, structures and stress ratios modified by this transaction.
+        // In lazy mode, the stress ratios changed by deferred structures are recorded by solvePending() instead.
+        TransactionResult modify(Transaction const& transaction, ChangeRecord& changes) {
+            return WorldUpdater{ data_ }.runTransaction(transaction, changes);
+        }
+
+        TransactionResult modify(Transaction const& transaction, ChangeRecord& changes, utils::cExecutor auto& executor) {
+            return WorldUpdater{ data_ }.runTransaction(transaction, changes, executor);
+        }
+
         [[nodiscard]]
         Scene const& scene() const {
             return data_.scene;
         }
 
+        // Bytes of solutions held in full, their basis (potentials) excluded. Enforced after each modify() and solvePending():
+        // the least recently read solutions are reduced to their basis, and rebuilt without re-solving on their next read.
+        // std::nullopt (default): no budget. Reads update the recency of solutions: concurrent readers should use snapshot().
+        void setSolutionMemoryBudget(std::optional<std::size_t> budget) {
+            WorldUpdater{ data_ }.setSolutionMemoryBudget(budget);
+        }
+
+        void setSolveMode(SolveMode mode) {
+            data_.solveMode = mode;
+        }
+
+        // Priority of a pending structure in solvePending(budget). New structures have a priority of zero.
+        void setStructurePriority(StructureIndex structureId, Real<u.one> priority) {
+            data_.scene.structures().at(structureId).userData().setPriority(priority);
+        }
+
+        // Immutable copy of the world, safe to read from any thread while this world is modified. Solves deferred structures.
+        // Must be called from the thread calling modify(): only the parts modified since the last snapshot are copied.
+        [[nodiscard]]
+        std::shared_ptr<Snapshot const> snapshot() {
+            return SnapshotBuilder{ data_ }.run();
+        }
+
+        [[nodiscard]]
+        std::optional<std::size_t> const& solutionMemoryBudget() const {
+            return data_.solutionCache.budget();
+        }
+
+        // Memory used by the solutions held in full. Always zero if there is no budget.
+        [[nodiscard]]
+        std::size_t solutionMemoryUsage() const {
+            return data_.solutionCache.usedMemory();
+        }
+
+        // Lazy: new & modified structures stay unsolved until first read, or until solvePending() is called.
+        // Structures replaced by a later transaction before being read are never solved.
+        [[nodiscard]]
+        SolveMode solveMode() const {
+            return data_.solveMode;
+        }
+
+        // Solves all the structures deferred by lazy mode.
+        void solvePending() {
+            WorldUpdater{ data_ }.solvePending();
+        }
+
+        void solvePending(utils::cExecutor auto& executor) {
+            WorldUpdater{ data_ }.solvePending(executor);
+        }
+
+        // changes: the stress ratios modified by the solved structures are appended to it.
+        void solvePending(ChangeRecord& changes) {
+            WorldUpdater{ data_ }.solvePending(changes);
+        }
+
+        void solvePending(ChangeRecord& changes, utils::cExecutor auto& executor) {
+            WorldUpdater{ data_ }.solvePending(changes, executor);
+        }
+
+        // Solves the pending structures by decreasing priority, and stops once the budget is spent.
+        // A structure is never split: at least one is solved per call, and the last one can overrun the budget.
+        void solvePending(std::chrono::nanoseconds budget) {
+            WorldUpdater{ data_ }.solvePending(budget);
+        }
+
+        void solvePending(std::chrono::nanoseconds budget, ChangeRecord& changes) {
+            WorldUpdater{ data_ }.solvePending(budget, changes);
+        }
+
         [[nodiscard]]
         Structures structures() const {
             return Structures{ data_ };
@@ -28,6 +28,7 @@
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/cfg/LibTraits.hpp>
 #include <gustave/core/model/Stress.hpp>
+#include <gustave/core/worlds/syncWorld/detail/StructureSolver.hpp>
 #include <gustave/core/worlds/syncWorld/detail/WorldData.hpp>
 #include <gustave/core/worlds/syncWorld/forwardDecls.hpp>
 #include <gustave/core/worlds/syncWorld/ContactReference.hpp>
@@ -54,6 +55,7 @@ namespace gustave::core::worlds::syncWorld {
     public:
         using BlockIndex = WorldData::Scene::BlockIndex;
         using ContactReference = syncWorld::ContactReference<libCfg>;
+        using MaterialIndex = SceneBlock::MaterialIndex;
         using PressureStress = model::PressureStress<libCfg>;
         using StressRatio = model::StressRatio<libCfg>;
         using StructureReference = syncWorld::StructureReference<libCfg>;
@@ -245,6 +247,11 @@ namespace gustave::core::worlds::syncWorld {
             return sceneBlock_.mass();
         }
 
+        [[nodiscard]]
+        MaterialIndex materialId() const {
+            return sceneBlock_.materialId();
+        }
+
         [[nodiscard]]
         PressureStress const& maxPressureStress() const {
             return sceneBlock_.maxPressureStress();
@@ -255,14 +262,10 @@ namespace gustave::core::worlds::syncWorld {
             return sceneBlock_.position();
         }
 
+        // Computed by the world when the structures of this block are solved. Contacts of pending structures are ignored.
         [[nodiscard]]
-        StressRatio stressRatio() const {
-            PressureStress const stressMax = maxPressureStress();
-            StressRatio result{ 0.f * u.one, 0.f * u.one, 0.f * u.one };
-            for (auto const& contact : contacts()) {
-                result.mergeMax(contact.pressureStress() / stressMax);
-            }
-            return result;
+        StressRatio const& stressRatio() const {
+            return sceneBlock_.userData().stressRatio();
         }
 
         [[nodiscard]]
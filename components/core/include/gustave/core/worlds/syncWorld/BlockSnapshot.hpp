@@ -0,0 +1,98 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <optional>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/model/Stress.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockIndex.hpp>
+
+namespace gustave::core::worlds::syncWorld {
+    template<cfg::cLibConfig auto libCfg>
+    class BlockSnapshot {
+    private:
+        static constexpr auto u = cfg::units(libCfg);
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
+    public:
+        using BlockIndex = scenes::cuboidGridScene::BlockIndex;
+        using PressureStress = model::PressureStress<libCfg>;
+        using StressRatio = model::StressRatio<libCfg>;
+        using StructureIndex = cfg::StructureIndex<libCfg>;
+
+        // structureIndex: structure of a non-foundation block (empty for foundations).
+        [[nodiscard]]
+        explicit BlockSnapshot(BlockIndex const& index, Real<u.mass> mass, PressureStress const& maxPressureStress,
+                StressRatio const& stressRatio, std::optional<StructureIndex> structureIndex)
+            : index_{ index }
+            , maxPressureStress_{ maxPressureStress }
+            , stressRatio_{ stressRatio }
+            , structureIndex_{ structureIndex }
+            , mass_{ mass }
+        {}
+
+        [[nodiscard]]
+        BlockIndex const& index() const {
+            return index_;
+        }
+
+        [[nodiscard]]
+        bool isFoundation() const {
+            return !structureIndex_;
+        }
+
+        [[nodiscard]]
+        Real<u.mass> mass() const {
+            return mass_;
+        }
+
+        [[nodiscard]]
+        PressureStress const& maxPressureStress() const {
+            return maxPressureStress_;
+        }
+
+        // Stress ratio after the last solve of the block's structures (contacts of unsolved structures are ignored).
+        [[nodiscard]]
+        StressRatio const& stressRatio() const {
+            return stressRatio_;
+        }
+
+        [[nodiscard]]
+        std::optional<StructureIndex> const& structureIndex() const {
+            return structureIndex_;
+        }
+    private:
+        BlockIndex index_;
+        PressureStress maxPressureStress_;
+        StressRatio stressRatio_;
+        std::optional<StructureIndex> structureIndex_;
+        Real<u.mass> mass_;
+    };
+}
@@ -26,6 +26,7 @@
 #pragma once
 
 #include <stdexcept>
+#include <vector>
 
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/core/worlds/syncWorld/detail/WorldData.hpp>
@@ -43,6 +44,7 @@ namespace gustave::core::worlds::syncWorld {
     public:
         using BlockIndex = WorldData::Scene::BlockIndex;
         using BlockReference = syncWorld::BlockReference<libCfg>;
+        using BlockRegion = WorldData::Scene::BlockRegion;
     private:
         class Enumerator {
         private:
@@ -108,6 +110,16 @@ namespace gustave::core::worlds::syncWorld {
             return BlockReference{ sceneBlocks_.find(index) };
         }
 
+        // Blocks inside region, in unspecified order.
+        [[nodiscard]]
+        std::vector<BlockReference> inRegion(BlockRegion const& region) const {
+            std::vector<BlockReference> result;
+            for (auto&& sceneBlock : sceneBlocks_.inRegion(region)) {
+                result.emplace_back(std::move(sceneBlock));
+            }
+            return result;
+        }
+
         [[nodiscard]]
         std::size_t size() const {
             return sceneBlocks_.size();
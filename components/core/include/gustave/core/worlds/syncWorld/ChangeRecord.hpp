@@ -0,0 +1,163 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <vector>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/model/Stress.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockIndex.hpp>
+#include <gustave/core/worlds/syncWorld/forwardDecls.hpp>
+
+namespace gustave::core::worlds::syncWorld {
+    // Changes made to a world by a modification.
+    template<cfg::cLibConfig auto libCfg>
+    class ChangeRecord {
+    private:
+        static constexpr auto u = cfg::units(libCfg);
+        static constexpr auto rt = libCfg.realTraits;
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
+    public:
+        using BlockIndex = scenes::cuboidGridScene::BlockIndex;
+        using StressRatio = model::StressRatio<libCfg>;
+        using StructureIndex = cfg::StructureIndex<libCfg>;
+
+        class StressChange {
+        public:
+            [[nodiscard]]
+            explicit StressChange(BlockIndex const& index, StressRatio const& oldStressRatio, StressRatio const& newStressRatio)
+                : index_{ index }
+                , oldStressRatio_{ oldStressRatio }
+                , newStressRatio_{ newStressRatio }
+            {}
+
+            [[nodiscard]]
+            BlockIndex const& index() const {
+                return index_;
+            }
+
+            [[nodiscard]]
+            StressRatio const& newStressRatio() const {
+                return newStressRatio_;
+            }
+
+            [[nodiscard]]
+            StressRatio const& oldStressRatio() const {
+                return oldStressRatio_;
+            }
+
+            [[nodiscard]]
+            bool operator==(StressChange const&) const = default;
+        private:
+            BlockIndex index_;
+            StressRatio oldStressRatio_;
+            StressRatio newStressRatio_;
+        };
+
+        // stressEpsilon: minimum variation of a stress ratio coordinate for a block to be listed in stressChanges().
+        [[nodiscard]]
+        explicit ChangeRecord(Real<u.one> stressEpsilon)
+            : stressEpsilon_{ stressEpsilon }
+        {
+            assert(stressEpsilon_ >= 0.f);
+        }
+
+        // Includes the blocks of the transaction's filled regions. A block replaced by the transaction is both removed and added.
+        [[nodiscard]]
+        std::vector<BlockIndex> const& addedBlocks() const {
+            return addedBlocks_;
+        }
+
+        [[nodiscard]]
+        std::vector<StructureIndex> const& deletedStructures() const {
+            return deletedStructures_;
+        }
+
+        // Structures that kept their index, but whose blocks' masses or materials changed.
+        [[nodiscard]]
+        std::vector<StructureIndex> const& modifiedStructures() const {
+            return modifiedStructures_;
+        }
+
+        [[nodiscard]]
+        std::vector<StructureIndex> const& newStructures() const {
+            return newStructures_;
+        }
+
+        // Includes the blocks of the transaction's cleared regions. Each block is listed once.
+        [[nodiscard]]
+        std::vector<BlockIndex> const& removedBlocks() const {
+            return removedBlocks_;
+        }
+
+        // Remaining blocks whose stress ratio changed by more than stressEpsilon().
+        // Contacts of unsolved structures are ignored by the ratios (removed and added blocks are not listed).
+        [[nodiscard]]
+        std::vector<StressChange> const& stressChanges() const {
+            return stressChanges_;
+        }
+
+        [[nodiscard]]
+        Real<u.one> stressEpsilon() const {
+            return stressEpsilon_;
+        }
+    private:
+        friend class detail::StructureSolver<libCfg>;
+        friend class detail::WorldUpdater<libCfg>;
+
+        void clear() {
+            addedBlocks_.clear();
+            removedBlocks_.clear();
+            modifiedStructures_.clear();
+            newStructures_.clear();
+            deletedStructures_.clear();
+            stressChanges_.clear();
+        }
+
+        void recordStressChange(BlockIndex const& index, StressRatio const& oldRatio, StressRatio const& newRatio) {
+            Real<u.one> const delta = rt.max(rt.max(
+                rt.abs(newRatio.compression() - oldRatio.compression()),
+                rt.abs(newRatio.shear() - oldRatio.shear())),
+                rt.abs(newRatio.tensile() - oldRatio.tensile()));
+            if (delta > stressEpsilon_) {
+                stressChanges_.emplace_back(index, oldRatio, newRatio);
+            }
+        }
+
+        std::vector<BlockIndex> addedBlocks_;
+        std::vector<BlockIndex> removedBlocks_;
+        std::vector<StructureIndex> modifiedStructures_;
+        std::vector<StructureIndex> newStructures_;
+        std::vector<StructureIndex> deletedStructures_;
+        std::vector<StressChange> stressChanges_;
+        Real<u.one> stressEpsilon_;
+    };
+}
@@ -30,9 +30,11 @@
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/cfg/LibTraits.hpp>
 #include <gustave/core/model/Stress.hpp>
+#include <gustave/core/worlds/syncWorld/detail/StructureSolver.hpp>
 #include <gustave/core/worlds/syncWorld/detail/WorldData.hpp>
 #include <gustave/core/worlds/syncWorld/forwardDecls.hpp>
 #include <gustave/core/worlds/syncWorld/BlockReference.hpp>
+#include <gustave/core/worlds/syncWorld/ContactView.hpp>
 #include <gustave/core/worlds/syncWorld/StructureReference.hpp>
 
 namespace gustave::core::worlds::syncWorld {
@@ -53,6 +55,7 @@ namespace gustave::core::worlds::syncWorld {
     public:
         using BlockReference = syncWorld::BlockReference<libCfg>;
         using ContactIndex = WorldData::Scene::ContactIndex;
+        using ContactView = syncWorld::ContactView<libCfg>;
         using ForceStress = model::ForceStress<libCfg>;
         using PressureStress = SceneContact::PressureStress;
         using NormalizedVector3 = cfg::NormalizedVector3<libCfg>;
@@ -81,24 +84,12 @@ namespace gustave::core::worlds::syncWorld {
 
         [[nodiscard]]
         ForceStress forceStress() const {
-            Vector3<u.force> const vector = forceVector();
-            NormalizedVector3 const norm = normal();
-            Real<u.force> const normalCoord = vector.dot(norm);
-            Real<u.force> compression = 0.f * u.force;
-            Real<u.force> tensile = 0.f * u.force;
-            if (normalCoord < 0.f * u.force) {
-                compression = -normalCoord;
-            } else {
-                tensile = normalCoord;
-            }
-            Real<u.force> shear = (vector - normalCoord * norm).norm();
-            return ForceStress{ compression, shear, tensile };
+            return view().forceStress();
         }
 
         [[nodiscard]]
         Vector3<u.force> forceVector() const {
-            auto const structure = sceneContact_.structure();
-            return structure.userData().solution().contacts().at(sceneContact_.solverIndex()).forceVector();
+            return view().forceVector();
         }
 
         [[nodiscard]]
@@ -111,6 +102,12 @@ namespace gustave::core::worlds::syncWorld {
             return sceneContact_.invalidError();
         }
 
+        // Contact between the local block and the terrain: it has no other block, nor opposite contact.
+        [[nodiscard]]
+        bool isGroundContact() const {
+            return sceneContact_.isGroundContact();
+        }
+
         [[nodiscard]]
         bool isSolved() const {
             if (sceneContact_.isValid()) {
@@ -152,12 +149,12 @@ namespace gustave::core::worlds::syncWorld {
 
         [[nodiscard]]
         PressureStress pressureStress() const {
-            return forceStress() / sceneContact_.area();
+            return view().pressureStress();
         }
 
         [[nodiscard]]
         StressRatio stressRatio() const {
-            return forceStress() / (sceneContact_.maxPressureStress() * sceneContact_.area());
+            return view().stressRatio();
         }
 
         [[nodiscard]]
@@ -165,6 +162,13 @@ namespace gustave::core::worlds::syncWorld {
             return StructureReference{ sceneContact_.structure() };
         }
 
+        // Throws if the structure isn't solved. The view is only valid until the next modification of the world.
+        [[nodiscard]]
+        ContactView view() const {
+            auto const structure = sceneContact_.structure();
+            return ContactView{ sceneContact_.view(), &structure.userData().solution() };
+        }
+
         [[nodiscard]]
         bool operator==(ContactReference const&) const = default;
     private:
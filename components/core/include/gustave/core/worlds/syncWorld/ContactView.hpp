@@ -0,0 +1,153 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdexcept>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/model/Stress.hpp>
+#include <gustave/core/worlds/syncWorld/detail/WorldData.hpp>
+
+namespace gustave::core::worlds::syncWorld {
+    // Non-owning, read-only view of a contact, and of the solution of its structure.
+    // Only valid until the next modification of the world.
+    template<cfg::cLibConfig auto libCfg>
+    class ContactView {
+    private:
+        using WorldData = detail::WorldData<libCfg>;
+        using SceneContactView = WorldData::Scene::ContactView;
+        using Solution = WorldData::Solver::Solution;
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Vector3 = cfg::Vector3<libCfg, unit>;
+
+        static constexpr auto u = cfg::units(libCfg);
+    public:
+        using BlockView = WorldData::Scene::BlockView;
+        using ContactIndex = WorldData::Scene::ContactIndex;
+        using ForceStress = model::ForceStress<libCfg>;
+        using NormalizedVector3 = cfg::NormalizedVector3<libCfg>;
+        using PressureStress = model::PressureStress<libCfg>;
+        using StressRatio = model::StressRatio<libCfg>;
+
+        // solution: solution of the contact's structure, or nullptr if it isn't solved.
+        [[nodiscard]]
+        explicit ContactView(SceneContactView const& sceneContact, Solution const* solution)
+            : sceneContact_{ sceneContact }
+            , solution_{ solution }
+        {}
+
+        [[nodiscard]]
+        Real<u.area> area() const {
+            return sceneContact_.area();
+        }
+
+        [[nodiscard]]
+        ForceStress forceStress() const {
+            Vector3<u.force> const vector = forceVector();
+            NormalizedVector3 const norm = normal();
+            Real<u.force> const normalCoord = vector.dot(norm);
+            Real<u.force> compression = 0.f * u.force;
+            Real<u.force> tensile = 0.f * u.force;
+            if (normalCoord < 0.f * u.force) {
+                compression = -normalCoord;
+            } else {
+                tensile = normalCoord;
+            }
+            Real<u.force> shear = (vector - normalCoord * norm).norm();
+            return ForceStress{ compression, shear, tensile };
+        }
+
+        [[nodiscard]]
+        Vector3<u.force> forceVector() const {
+            if (solution_ == nullptr) {
+                throw std::logic_error("The structure must be in the 'Solved' state.");
+            }
+            return solution_->contacts().at(sceneContact_.solverIndex()).forceVector();
+        }
+
+        [[nodiscard]]
+        ContactIndex const& index() const {
+            return sceneContact_.index();
+        }
+
+        // Contact between the local block and the terrain: it has no other block, nor opposite contact.
+        [[nodiscard]]
+        bool isGroundContact() const {
+            return sceneContact_.isGroundContact();
+        }
+
+        [[nodiscard]]
+        bool isSolved() const {
+            return solution_ != nullptr;
+        }
+
+        [[nodiscard]]
+        BlockView localBlock() const {
+            return sceneContact_.localBlock();
+        }
+
+        [[nodiscard]]
+        PressureStress maxPressureStress() const {
+            return sceneContact_.maxPressureStress();
+        }
+
+        [[nodiscard]]
+        NormalizedVector3 normal() const {
+            return sceneContact_.normal();
+        }
+
+        [[nodiscard]]
+        ContactView opposite() const {
+            return ContactView{ sceneContact_.opposite(), solution_ };
+        }
+
+        [[nodiscard]]
+        BlockView otherBlock() const {
+            return sceneContact_.otherBlock();
+        }
+
+        [[nodiscard]]
+        PressureStress pressureStress() const {
+            return forceStress() / sceneContact_.area();
+        }
+
+        [[nodiscard]]
+        StressRatio stressRatio() const {
+            return forceStress() / (sceneContact_.maxPressureStress() * sceneContact_.area());
+        }
+
+        [[nodiscard]]
+        bool operator==(ContactView const&) const = default;
+    private:
+        SceneContactView sceneContact_;
+        Solution const* solution_;
+    };
+}
@@ -30,10 +30,13 @@
 
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/worlds/syncWorld/detail/StructureSolver.hpp>
 #include <gustave/core/worlds/syncWorld/detail/WorldData.hpp>
 #include <gustave/core/worlds/syncWorld/forwardDecls.hpp>
 #include <gustave/core/worlds/syncWorld/BlockReference.hpp>
 #include <gustave/core/worlds/syncWorld/ContactReference.hpp>
+#include <gustave/core/worlds/syncWorld/ContactView.hpp>
+#include <gustave/core/worlds/syncWorld/StructureStats.hpp>
 #include <gustave/utils/ForwardIterator.hpp>
 #include <gustave/utils/NoInit.hpp>
 
@@ -43,6 +46,9 @@ namespace gustave::core::worlds::syncWorld {
     private:
         static constexpr auto u = cfg::units(libCfg);
 
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
+
         template<cfg::cUnitOf<libCfg> auto unit>
         using Vector3 = cfg::Vector3<libCfg, unit>;
 
@@ -52,10 +58,13 @@ namespace gustave::core::worlds::syncWorld {
     public:
         using BlockIndex = WorldData::Scene::BlockIndex;
         using BlockReference = syncWorld::BlockReference<libCfg>;
+        using BlockViews = SceneStructureReference::BlockViews;
         using ContactIndex = WorldData::Scene::ContactIndex;
         using ContactReference = syncWorld::ContactReference<libCfg>;
+        using ContactView = syncWorld::ContactView<libCfg>;
         using State = WorldData::StructureState;
         using StructureIndex = WorldData::Scene::StructureIndex;
+        using StructureStats = syncWorld::StructureStats<libCfg>;
 
         class Blocks {
         private:
@@ -230,6 +239,75 @@ namespace gustave::core::worlds::syncWorld {
             SceneStructLinks sceneLinks_;
         };
 
+        class LinkViews {
+        private:
+            using SceneLinkViews = SceneStructureReference::LinkViews;
+            using SceneIterator = SceneLinkViews::Iterator;
+            using Solution = WorldData::Solver::Solution;
+
+            class Enumerator {
+            public:
+                [[nodiscard]]
+                Enumerator()
+                    : solution_{ nullptr }
+                    , sceneIterator_{}
+                {}
+
+                [[nodiscard]]
+                explicit Enumerator(LinkViews const& links)
+                    : solution_{ links.solution_ }
+                    , sceneIterator_{ links.sceneLinks_.begin() }
+                {}
+
+                [[nodiscard]]
+                bool isEnd() const {
+                    return sceneIterator_ == std::default_sentinel;
+                }
+
+                [[nodiscard]]
+                ContactView operator*() const {
+                    return ContactView{ *sceneIterator_, solution_ };
+                }
+
+                void operator++() {
+                    ++sceneIterator_;
+                }
+
+                [[nodiscard]]
+                bool operator==(Enumerator const& other) const {
+                    return sceneIterator_ == other.sceneIterator_;
+                }
+            private:
+                Solution const* solution_;
+                SceneIterator sceneIterator_;
+            };
+        public:
+            using Iterator = utils::ForwardIterator<Enumerator>;
+
+            [[nodiscard]]
+            explicit LinkViews(StructureReference const& structure)
+                : solution_{ nullptr }
+                , sceneLinks_{ structure.sceneStructRef_.linkViews() }
+            {
+                if (structure.isSolved()) {
+                    solution_ = &structure.sceneStructRef_.userData().solution();
+                }
+            }
+
+            [[nodiscard]]
+            Iterator begin() const {
+                return Iterator{ *this };
+            }
+
+            [[nodiscard]]
+            constexpr std::default_sentinel_t end() const {
+                return {};
+            }
+        private:
+            Solution const* solution_;
+            SceneLinkViews sceneLinks_;
+        };
+
         [[nodiscard]]
         explicit StructureReference(SceneStructureReference sceneStructRef)
             : sceneStructRef_{ std::move(sceneStructRef) }
@@ -253,6 +331,15 @@ namespace gustave::core::worlds::syncWorld {
             return Blocks{ *this };
         }
 
+        // Non-owning iteration, without reference counting. Only valid until the next modification of the world.
+        [[nodiscard]]
+        BlockViews blockViews() const {
+            if (!isValid()) {
+                throw invalidError();
+            }
+            return sceneStructRef_.blockViews();
+        }
+
         [[nodiscard]]
         Contacts contacts() const {
             if (!isValid()) {
@@ -293,7 +380,7 @@ namespace gustave::core::worlds::syncWorld {
 
         [[nodiscard]]
         bool isValid() const {
-            return state() != State::Invalid;
+            return sceneStructRef_.isValid();
         }
 
         [[nodiscard]]
@@ -304,6 +391,23 @@ namespace gustave::core::worlds::syncWorld {
             return Links{ *this };
         }
 
+        // Non-owning iteration, without reference counting. Only valid until the next modification of the world.
+        [[nodiscard]]
+        LinkViews linkViews() const {
+            if (!isValid()) {
+                throw invalidError();
+            }
+            return LinkViews{ *this };
+        }
+
+        [[nodiscard]]
+        Real<u.one> priority() const {
+            if (!isValid()) {
+                throw invalidError();
+            }
+            return sceneStructRef_.userData().priority();
+        }
+
         [[nodiscard]]
         State state() const {
             if (not sceneStructRef_.isValid()) {
@@ -312,6 +416,15 @@ namespace gustave::core::worlds::syncWorld {
             return sceneStructRef_.userData().state();
         }
 
+        // Aggregates computed when the structure was last solved.
+        [[nodiscard]]
+        StructureStats const& stats() const {
+            if (!isValid()) {
+                throw invalidError();
+            }
+            return sceneStructRef_.userData().stats();
+        }
+
         [[nodiscard]]
         bool operator==(StructureReference const&) const = default;
     private:
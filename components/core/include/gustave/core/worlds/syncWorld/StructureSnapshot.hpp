@@ -0,0 +1,97 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/solvers/Force1Solver.hpp>
+#include <gustave/core/worlds/syncWorld/StructureState.hpp>
+#include <gustave/core/worlds/syncWorld/StructureStats.hpp>
+
+namespace gustave::core::worlds::syncWorld {
+    template<cfg::cLibConfig auto libCfg>
+    class StructureSnapshot {
+    public:
+        using Solution = solvers::Force1Solver<libCfg>::Solution;
+        using State = StructureState;
+        using StructureIndex = cfg::StructureIndex<libCfg>;
+        using StructureStats = syncWorld::StructureStats<libCfg>;
+
+        // solution: nullptr unless state is Solved.
+        [[nodiscard]]
+        explicit StructureSnapshot(StructureIndex index, State state, std::shared_ptr<Solution const> solution, StructureStats const& stats)
+            : solution_{ std::move(solution) }
+            , stats_{ stats }
+            , index_{ index }
+            , state_{ state }
+        {
+            assert((state_ == State::Solved) == (solution_ != nullptr));
+        }
+
+        [[nodiscard]]
+        StructureIndex index() const {
+            return index_;
+        }
+
+        [[nodiscard]]
+        bool isSolved() const {
+            return state_ == State::Solved;
+        }
+
+        [[nodiscard]]
+        Solution const& solution() const {
+            if (!isSolved()) {
+                throw std::logic_error("The structure must be in the 'Solved' state.");
+            }
+            return *solution_;
+        }
+
+        [[nodiscard]]
+        std::shared_ptr<Solution const> const& solutionPtr() const {
+            return solution_;
+        }
+
+        [[nodiscard]]
+        State state() const {
+            return state_;
+        }
+
+        [[nodiscard]]
+        StructureStats const& stats() const {
+            return stats_;
+        }
+    private:
+        std::shared_ptr<Solution const> solution_;
+        StructureStats stats_;
+        StructureIndex index_;
+        State state_;
+    };
+}
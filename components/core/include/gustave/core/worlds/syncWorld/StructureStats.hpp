@@ -0,0 +1,119 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <optional>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/model/Stress.hpp>
+#include <gustave/core/scenes/cuboidGridScene/ContactIndex.hpp>
+
+namespace gustave::core::worlds::syncWorld {
+    // Aggregated data of a structure, computed each time the structure is solved.
+    template<cfg::cLibConfig auto libCfg>
+    class StructureStats {
+    private:
+        static constexpr auto u = cfg::units(libCfg);
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Real = cfg::Real<libCfg, unit>;
+
+        template<cfg::cUnitOf<libCfg> auto unit>
+        using Vector3 = cfg::Vector3<libCfg, unit>;
+    public:
+        using ContactIndex = scenes::cuboidGridScene::ContactIndex;
+        using StressRatio = model::StressRatio<libCfg>;
+
+        [[nodiscard]]
+        StructureStats()
+            : massMoment_{ Vector3<u.mass * u.length>::zero() }
+            , maxStressRatio_{ 0.f * u.one, 0.f * u.one, 0.f * u.one }
+            , mass_{ 0.f * u.mass }
+            , blockCount_{ 0 }
+            , maxLinkRatio_{ 0.f * u.one }
+        {}
+
+        void addBlock(Real<u.mass> mass, Vector3<u.length> const& position) {
+            massMoment_ += mass * position;
+            mass_ += mass;
+            ++blockCount_;
+        }
+
+        void addLink(ContactIndex const& index, StressRatio const& stressRatio) {
+            maxStressRatio_.mergeMax(stressRatio);
+            Real<u.one> const linkRatio = stressRatio.maxCoord();
+            if (!weakestLink_ || linkRatio > maxLinkRatio_) {
+                weakestLink_ = index;
+                maxLinkRatio_ = linkRatio;
+            }
+        }
+
+        [[nodiscard]]
+        std::size_t blockCount() const {
+            return blockCount_;
+        }
+
+        // True if the stress ratio of a link exceeds 1 (compression, shear or tensile).
+        [[nodiscard]]
+        bool isOverloaded() const {
+            return maxLinkRatio_ > 1.f;
+        }
+
+        [[nodiscard]]
+        Real<u.mass> mass() const {
+            return mass_;
+        }
+
+        [[nodiscard]]
+        Vector3<u.length> massCenter() const {
+            assert(blockCount_ > 0);
+            return massMoment_ / mass_;
+        }
+
+        // Maximum of each coordinate of the links' stress ratios (zero if the structure isn't solved).
+        [[nodiscard]]
+        StressRatio const& maxStressRatio() const {
+            return maxStressRatio_;
+        }
+
+        // Link with the highest stress ratio coordinate (empty if the structure isn't solved or has no links).
+        [[nodiscard]]
+        std::optional<ContactIndex> const& weakestLink() const {
+            return weakestLink_;
+        }
+    private:
+        Vector3<u.mass * u.length> massMoment_;
+        StressRatio maxStressRatio_;
+        std::optional<ContactIndex> weakestLink_;
+        Real<u.mass> mass_;
+        std::size_t blockCount_;
+        Real<u.one> maxLinkRatio_;
+    };
+}
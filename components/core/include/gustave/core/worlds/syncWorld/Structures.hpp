@@ -26,6 +26,7 @@
 #pragma once
 
 #include <stdexcept>
+#include <vector>
 
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/core/worlds/syncWorld/detail/WorldData.hpp>
@@ -37,6 +38,7 @@ namespace gustave::core::worlds::syncWorld {
     template<cfg::cLibConfig auto libCfg>
     class Structures {
     public:
+        using BlockRegion = detail::WorldData<libCfg>::Scene::BlockRegion;
         using StructureReference = syncWorld::StructureReference<libCfg>;
         using StructureIndex = StructureReference::StructureIndex;
     private:
@@ -109,6 +111,16 @@ namespace gustave::core::worlds::syncWorld {
             return StructureReference{ sceneStructs_.find(index) };
         }
 
+        // Structures with at least one block inside region, in unspecified order.
+        [[nodiscard]]
+        std::vector<StructureReference> intersecting(BlockRegion const& region) const {
+            std::vector<StructureReference> result;
+            for (auto&& sceneStructure : sceneStructs_.intersecting(region)) {
+                result.emplace_back(std::move(sceneStructure));
+            }
+            return result;
+        }
+
         [[nodiscard]]
         std::size_t size() const {
             return sceneStructs_.size();
@@ -0,0 +1,119 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/ChunkGrid.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockIndex.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockRegion.hpp>
+#include <gustave/core/worlds/syncWorld/BlockSnapshot.hpp>
+#include <gustave/core/worlds/syncWorld/forwardDecls.hpp>
+#include <gustave/core/worlds/syncWorld/StructureSnapshot.hpp>
+#include <gustave/utils/FlatHashMap.hpp>
+
+namespace gustave::core::worlds::syncWorld {
+    // Immutable copy of the blocks and structures of a world, that can be read from any thread.
+    // Consecutive snapshots share the chunks of blocks and the structures that didn't change between them.
+    template<cfg::cLibConfig auto libCfg>
+    class WorldSnapshot {
+    public:
+        using BlockIndex = scenes::cuboidGridScene::BlockIndex;
+        using BlockRegion = scenes::cuboidGridScene::BlockRegion;
+        using BlockSnapshot = syncWorld::BlockSnapshot<libCfg>;
+        using StructureIndex = cfg::StructureIndex<libCfg>;
+        using StructureSnapshot = syncWorld::StructureSnapshot<libCfg>;
+    private:
+        using ChunkGrid = scenes::cuboidGridScene::detail::ChunkGrid;
+
+        using Chunk = utils::FlatHashMap<BlockIndex, BlockSnapshot>;
+        using Chunks = utils::FlatHashMap<BlockIndex, std::shared_ptr<Chunk const>>;
+        using Structures = utils::FlatHashMap<StructureIndex, std::shared_ptr<StructureSnapshot const>>;
+    public:
+        [[nodiscard]]
+        WorldSnapshot()
+            : blockCount_{ 0 }
+        {}
+
+        [[nodiscard]]
+        std::size_t blockCount() const {
+            return blockCount_;
+        }
+
+        // Returns nullptr if the block doesn't exist.
+        [[nodiscard]]
+        BlockSnapshot const* findBlock(BlockIndex const& index) const {
+            auto const chunkIt = chunks_.find(ChunkGrid::chunkIdOf(index));
+            if (chunkIt == chunks_.end()) {
+                return nullptr;
+            }
+            Chunk const& chunk = *chunkIt->second;
+            auto const blockIt = chunk.find(index);
+            if (blockIt == chunk.end()) {
+                return nullptr;
+            }
+            return &blockIt->second;
+        }
+
+        // Returns nullptr if the structure doesn't exist.
+        [[nodiscard]]
+        StructureSnapshot const* findStructure(StructureIndex index) const {
+            auto const it = structures_.find(index);
+            if (it == structures_.end()) {
+                return nullptr;
+            }
+            return it->second.get();
+        }
+
+        void forEachBlock(auto&& visitor) const {
+            for (auto const& chunkEntry : chunks_) {
+                for (auto const& blockEntry : *chunkEntry.second) {
+                    visitor(blockEntry.second);
+                }
+            }
+        }
+
+        void forEachStructure(auto&& visitor) const {
+            for (auto const& entry : structures_) {
+                visitor(*entry.second);
+            }
+        }
+
+        [[nodiscard]]
+        std::size_t structureCount() const {
+            return structures_.size();
+        }
+    private:
+        friend class detail::SnapshotBuilder<libCfg>;
+
+        Chunks chunks_;
+        Structures structures_;
+        std::size_t blockCount_;
+    };
+}
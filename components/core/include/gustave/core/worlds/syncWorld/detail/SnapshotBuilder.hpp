@@ -0,0 +1,134 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/ChunkGrid.hpp>
+#include <gustave/core/worlds/syncWorld/detail/StructureSolver.hpp>
+#include <gustave/core/worlds/syncWorld/detail/WorldData.hpp>
+#include <gustave/core/worlds/syncWorld/WorldSnapshot.hpp>
+#include <gustave/utils/SerialExecutor.hpp>
+
+namespace gustave::core::worlds::syncWorld::detail {
+    // Builds a new snapshot from the previous one: only the dirty chunks & structures are copied from the world.
+    template<cfg::cLibConfig auto libCfg>
+    class SnapshotBuilder {
+    public:
+        using WorldData = detail::WorldData<libCfg>;
+        using WorldSnapshot = syncWorld::WorldSnapshot<libCfg>;
+    private:
+        using BlockIndex = WorldSnapshot::BlockIndex;
+        using BlockSnapshot = WorldSnapshot::BlockSnapshot;
+        using Chunk = WorldSnapshot::Chunk;
+        using ChunkGrid = scenes::cuboidGridScene::detail::ChunkGrid;
+        using SnapshotCache = detail::SnapshotCache<libCfg>;
+        using StructureIndex = WorldSnapshot::StructureIndex;
+        using StructureSnapshot = WorldSnapshot::StructureSnapshot;
+    public:
+        [[nodiscard]]
+        explicit SnapshotBuilder(WorldData& data)
+            : data_{ data }
+        {}
+
+        // Deferred structures are solved first.
+        std::shared_ptr<WorldSnapshot const> run() {
+            if (!data_.pendingStructures.empty()) {
+                utils::SerialExecutor executor;
+                StructureSolver<libCfg>{ data_ }.runPending(executor);
+            }
+            SnapshotCache& cache = data_.snapshots;
+            if (!cache.isDirty()) {
+                return cache.snapshot_;
+            }
+            if (cache.isFullyDirty_) {
+                invalidateAll(cache);
+            }
+            auto result = std::make_shared<WorldSnapshot>(*cache.snapshot_);
+            for (BlockIndex const& chunkId : cache.dirtyChunks_) {
+                updateChunk(*result, chunkId);
+            }
+            for (StructureIndex const structureId : cache.dirtyStructures_) {
+                updateStructure(*result, structureId);
+            }
+            cache.dirtyChunks_.clear();
+            cache.dirtyStructures_.clear();
+            cache.isFullyDirty_ = false;
+            cache.snapshot_ = std::move(result);
+            return cache.snapshot_;
+        }
+    private:
+        void invalidateAll(SnapshotCache& cache) const {
+            for (auto const& chunkEntry : cache.snapshot_->chunks_) {
+                cache.dirtyChunks_.insert(chunkEntry.first);
+            }
+            for (auto const& block : data_.scene.blocks()) {
+                cache.invalidateBlock(block.index());
+            }
+            for (auto const& structureEntry : cache.snapshot_->structures_) {
+                cache.dirtyStructures_.insert(structureEntry.first);
+            }
+            for (auto const& structure : data_.scene.structures()) {
+                cache.dirtyStructures_.insert(structure.index());
+            }
+        }
+
+        void updateChunk(WorldSnapshot& snapshot, BlockIndex const& chunkId) const {
+            auto chunk = std::make_shared<Chunk>();
+            for (auto const& block : data_.scene.blocks().inRegion(ChunkGrid::chunkRegionOf(chunkId))) {
+                std::optional<StructureIndex> structureId;
+                if (!block.isFoundation()) {
+                    structureId = block.structures().unique().index();
+                }
+                auto const blockSnapshot = BlockSnapshot{ block.index(), block.mass(), block.maxPressureStress(), block.userData().stressRatio(), structureId };
+                chunk->tryEmplace(block.index(), blockSnapshot);
+            }
+            auto const oldIt = snapshot.chunks_.find(chunkId);
+            if (oldIt != snapshot.chunks_.end()) {
+                snapshot.blockCount_ -= oldIt->second->size();
+                snapshot.chunks_.erase(chunkId);
+            }
+            if (chunk->size() > 0) {
+                snapshot.blockCount_ += chunk->size();
+                snapshot.chunks_.tryEmplace(chunkId, std::move(chunk));
+            }
+        }
+
+        void updateStructure(WorldSnapshot& snapshot, StructureIndex structureId) const {
+            snapshot.structures_.erase(structureId);
+            auto const structure = data_.scene.structures().find(structureId);
+            if (structure.isValid()) {
+                auto const& userData = structure.userData();
+                auto structureSnapshot = std::make_shared<StructureSnapshot const>(structureId, userData.state(), userData.solutionPtr(), userData.stats());
+                snapshot.structures_.tryEmplace(structureId, std::move(structureSnapshot));
+            }
+        }
+
+        WorldData& data_;
+    };
+}
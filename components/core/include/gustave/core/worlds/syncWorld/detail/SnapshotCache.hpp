@@ -0,0 +1,92 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <memory>
+#include <unordered_set>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/ChunkGrid.hpp>
+#include <gustave/core/worlds/syncWorld/forwardDecls.hpp>
+#include <gustave/core/worlds/syncWorld/WorldSnapshot.hpp>
+
+namespace gustave::core::worlds::syncWorld::detail {
+    // Last snapshot built, and the chunks/structures modified since.
+    template<cfg::cLibConfig auto libCfg>
+    class SnapshotCache {
+    private:
+        using ChunkGrid = scenes::cuboidGridScene::detail::ChunkGrid;
+    public:
+        using WorldSnapshot = syncWorld::WorldSnapshot<libCfg>;
+
+        using BlockIndex = WorldSnapshot::BlockIndex;
+        using BlockRegion = WorldSnapshot::BlockRegion;
+        using StructureIndex = WorldSnapshot::StructureIndex;
+
+        [[nodiscard]]
+        SnapshotCache()
+            : snapshot_{ std::make_shared<WorldSnapshot const>() }
+            , isFullyDirty_{ false }
+        {}
+
+        void invalidateAll() {
+            isFullyDirty_ = true;
+        }
+
+        void invalidateBlock(BlockIndex const& index) {
+            dirtyChunks_.insert(ChunkGrid::chunkIdOf(index));
+        }
+
+        void invalidateRegion(BlockRegion const& region) {
+            BlockIndex const minChunk = ChunkGrid::chunkIdOf(region.minIndex());
+            BlockIndex const maxChunk = ChunkGrid::chunkIdOf(region.maxIndex());
+            for (auto z = minChunk.z; z <= maxChunk.z; ++z) {
+                for (auto y = minChunk.y; y <= maxChunk.y; ++y) {
+                    for (auto x = minChunk.x; x <= maxChunk.x; ++x) {
+                        dirtyChunks_.insert({ x, y, z });
+                    }
+                }
+            }
+        }
+
+        void invalidateStructure(StructureIndex index) {
+            dirtyStructures_.insert(index);
+        }
+
+        [[nodiscard]]
+        bool isDirty() const {
+            return isFullyDirty_ || !dirtyChunks_.empty() || !dirtyStructures_.empty();
+        }
+    private:
+        friend class SnapshotBuilder<libCfg>;
+
+        std::shared_ptr<WorldSnapshot const> snapshot_;
+        std::unordered_set<BlockIndex> dirtyChunks_;
+        std::unordered_set<StructureIndex> dirtyStructures_;
+        bool isFullyDirty_;
+    };
+}
@@ -0,0 +1,134 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <list>
+#include <optional>
+#include <unordered_map>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+
+namespace gustave::core::worlds::syncWorld::detail {
+    // Memory used by the solutions held in full, ordered from the most to the least recently used.
+    // Tracking is disabled until a budget is set.
+    template<cfg::cLibConfig auto libCfg>
+    class SolutionCache {
+    public:
+        using StructureIndex = cfg::StructureIndex<libCfg>;
+    private:
+        using LruList = std::list<StructureIndex>;
+
+        struct Entry {
+            typename LruList::iterator lruPosition;
+            std::size_t memory;
+        };
+    public:
+        [[nodiscard]]
+        SolutionCache()
+            : usedMemory_{ 0 }
+        {}
+
+        [[nodiscard]]
+        std::optional<std::size_t> const& budget() const {
+            return budget_;
+        }
+
+        [[nodiscard]]
+        bool contains(StructureIndex index) const {
+            return entries_.contains(index);
+        }
+
+        void erase(StructureIndex index) {
+            auto const it = entries_.find(index);
+            if (it != entries_.end()) {
+                usedMemory_ -= it->second.memory;
+                lru_.erase(it->second.lruPosition);
+                entries_.erase(it);
+            }
+        }
+
+        // Inserts (or replaces) a solution as the most recently used.
+        void insert(StructureIndex index, std::size_t memory) {
+            assert(isEnabled());
+            erase(index);
+            lru_.push_front(index);
+            entries_.emplace(index, Entry{ lru_.begin(), memory });
+            usedMemory_ += memory;
+        }
+
+        [[nodiscard]]
+        bool isEnabled() const {
+            return budget_.has_value();
+        }
+
+        [[nodiscard]]
+        bool isOverBudget() const {
+            return budget_ && usedMemory_ > *budget_;
+        }
+
+        [[nodiscard]]
+        StructureIndex leastRecentlyUsed() const {
+            assert(!lru_.empty());
+            return lru_.back();
+        }
+
+        // Disabling the cache forgets all the tracked solutions.
+        void setBudget(std::optional<std::size_t> budget) {
+            budget_ = budget;
+            if (!budget_) {
+                entries_.clear();
+                lru_.clear();
+                usedMemory_ = 0;
+            }
+        }
+
+        [[nodiscard]]
+        std::size_t size() const {
+            return entries_.size();
+        }
+
+        // Marks a tracked solution as the most recently used.
+        void touch(StructureIndex index) {
+            auto const it = entries_.find(index);
+            if (it != entries_.end()) {
+                lru_.splice(lru_.begin(), lru_, it->second.lruPosition);
+            }
+        }
+
+        [[nodiscard]]
+        std::size_t usedMemory() const {
+            return usedMemory_;
+        }
+    private:
+        std::optional<std::size_t> budget_;
+        LruList lru_;
+        std::unordered_map<StructureIndex, Entry> entries_;
+        std::size_t usedMemory_;
+    };
+}
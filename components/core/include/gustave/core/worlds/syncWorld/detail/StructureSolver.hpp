@@ -0,0 +1,280 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/LibTraits.hpp>
+#include <gustave/core/model/Stress.hpp>
+#include <gustave/core/worlds/syncWorld/detail/StructureUserData.hpp>
+#include <gustave/core/worlds/syncWorld/detail/WorldData.hpp>
+#include <gustave/core/worlds/syncWorld/ChangeRecord.hpp>
+#include <gustave/core/worlds/syncWorld/ContactView.hpp>
+#include <gustave/core/worlds/syncWorld/StructureState.hpp>
+#include <gustave/core/worlds/syncWorld/StructureStats.hpp>
+#include <gustave/utils/cExecutor.hpp>
+#include <gustave/utils/SerialExecutor.hpp>
+
+namespace gustave::core::worlds::syncWorld::detail {
+    // Solves structures, then updates the cached stress ratios of their blocks.
+    // Also evicts and rebuilds solutions for the world's solution cache.
+    template<cfg::cLibConfig auto libCfg>
+    class StructureSolver {
+    private:
+        using Basis = WorldData<libCfg>::Solver::Basis;
+        using BlockIndex = WorldData<libCfg>::Scene::BlockIndex;
+        using ContactView = syncWorld::ContactView<libCfg>;
+        using SceneBlockReference = WorldData<libCfg>::Scene::template BlockReference<true>;
+        using SceneStructureReference = WorldData<libCfg>::Scene::template StructureReference<true>;
+        using Solution = WorldData<libCfg>::Solver::Solution;
+        using StressRatio = model::StressRatio<libCfg>;
+        using StructureStats = syncWorld::StructureStats<libCfg>;
+        using StructureUserData = detail::StructureUserData<libCfg>;
+
+        static constexpr auto u = cfg::units(libCfg);
+    public:
+        using ChangeRecord = syncWorld::ChangeRecord<libCfg>;
+        using StructureIndex = WorldData<libCfg>::StructureIndex;
+        using WorldData = detail::WorldData<libCfg>;
+
+        [[nodiscard]]
+        explicit StructureSolver(WorldData& data)
+            : data_{ data }
+            , changes_{ nullptr }
+        {}
+
+        // changes: nullable. The stress changes of the updated blocks are appended to it.
+        [[nodiscard]]
+        explicit StructureSolver(WorldData& data, ChangeRecord* changes)
+            : data_{ data }
+            , changes_{ changes }
+        {}
+
+        // Evicts the least recently used solutions until the solution cache is within its budget.
+        // Only the basis of an evicted solution is kept: its decomposition is dropped too.
+        void evictOverBudget() {
+            auto& cache = data_.solutionCache;
+            while (cache.isOverBudget()) {
+                StructureIndex const structureId = cache.leastRecentlyUsed();
+                auto& userData = data_.scene.structures().at(structureId).userData();
+                userData.evictedBasis_ = userData.solution_->basisPtr();
+                userData.solution_ = nullptr;
+                userData.decomposition_ = nullptr;
+                cache.erase(structureId);
+            }
+        }
+
+        // Rebuilds the solution of an evicted structure, and marks it as the most recently used.
+        void loadSolution(StructureIndex structureId) {
+            auto& userData = data_.scene.structures().at(structureId).userData();
+            if (userData.isEvicted()) {
+                userData.solution_ = std::make_shared<Solution const>(std::exchange(userData.evictedBasis_, nullptr));
+                trackSolution(structureId, userData);
+            } else {
+                data_.solutionCache.touch(structureId);
+            }
+        }
+
+        void run(StructureIndex structureId) {
+            utils::SerialExecutor executor;
+            run(std::vector<StructureIndex>{ structureId }, executor);
+        }
+
+        // Structures are solved concurrently, each solver run also using the executor.
+        void run(std::vector<StructureIndex> const& structureIds, utils::cExecutor auto& executor) {
+            executor.parallelFor(structureIds.size(), [&](std::size_t id) {
+                solve(data_.scene.structures().at(structureIds[id]), executor);
+            });
+            updateSolvedStructures(structureIds);
+        }
+
+        void runPending(utils::cExecutor auto& executor) {
+            auto const& pending = data_.pendingStructures;
+            run(std::vector<StructureIndex>{ pending.begin(), pending.end() }, executor);
+        }
+
+        // Pending structures are solved one at a time by decreasing priority, until the budget is spent.
+        // The first one is solved even if the budget is zero, so that each call makes progress.
+        void runPending(std::chrono::nanoseconds budget, utils::cExecutor auto& executor) {
+            using Clock = std::chrono::steady_clock;
+            std::vector<StructureIndex> structureIds = pendingByPriority();
+            auto const startTime = Clock::now();
+            std::size_t solvedCount = 0;
+            while (solvedCount < structureIds.size() && (solvedCount == 0 || Clock::now() - startTime < budget)) {
+                solve(data_.scene.structures().at(structureIds[solvedCount]), executor);
+                ++solvedCount;
+            }
+            structureIds.resize(solvedCount);
+            updateSolvedStructures(structureIds);
+        }
+
+        // Registers all the solutions held in full in the solution cache.
+        void trackSolutions() {
+            for (auto&& structure : data_.scene.structures()) {
+                trackSolution(structure.index(), structure.userData());
+            }
+        }
+
+        // Foundations are updated at most once by this solver.
+        void updateBlock(SceneBlockReference block) {
+            if (block.isFoundation() && !visitedFoundations_.insert(block.index()).second) {
+                return;
+            }
+            StressRatio const newRatio = stressRatioOf(block);
+            auto& userData = block.userData();
+            if (changes_ != nullptr) {
+                changes_->recordStressChange(block.index(), userData.stressRatio(), newRatio);
+            }
+            userData.setStressRatio(newRatio);
+            data_.snapshots.invalidateBlock(block.index());
+        }
+    private:
+        // Basis of the current solution, evicted or not. The structure must be solved.
+        [[nodiscard]]
+        static Basis const& basisOf(StructureUserData const& userData) {
+            if (userData.isEvicted()) {
+                return *userData.evictedBasis_;
+            }
+            return userData.solution_->basis();
+        }
+
+        [[nodiscard]]
+        std::vector<StructureIndex> pendingByPriority() const {
+            auto const& pending = data_.pendingStructures;
+            std::vector<StructureIndex> result{ pending.begin(), pending.end() };
+            auto const& structures = data_.scene.structures();
+            std::ranges::sort(result, [&](StructureIndex lhs, StructureIndex rhs) {
+                auto const lhsPriority = structures.at(lhs).userData().priority();
+                auto const rhsPriority = structures.at(rhs).userData().priority();
+                if (lhsPriority != rhsPriority) {
+                    return lhsPriority > rhsPriority;
+                }
+                return lhs < rhs;
+            });
+            return result;
+        }
+
+        // Block updates are done once all structures are solved: a foundation can touch several of them.
+        void updateSolvedStructures(std::vector<StructureIndex> const& structureIds) {
+            for (StructureIndex const structureId : structureIds) {
+                data_.pendingStructures.erase(structureId);
+                data_.snapshots.invalidateStructure(structureId);
+                auto structure = data_.scene.structures().at(structureId);
+                structure.userData().attach(data_, structureId);
+                trackSolution(structureId, structure.userData());
+                for (auto&& block : structure.blocks()) {
+                    updateBlock(block);
+                }
+            }
+        }
+
+        void solve(SceneStructureReference structure, utils::cExecutor auto& executor) {
+            auto& userData = structure.userData();
+            if (userData.state_ == StructureState::New) {
+                auto const solverResult = data_.solver.run(structure.solverStructurePtr(), executor);
+                auto const& solution = solverResult.solutionPtr();
+                userData.solve(solution, solverResult.decompositionPtr(), statsOf(structure, solution.get()));
+            } else if (userData.state_ == StructureState::Solved) {
+                // The topology of a structure never changes: its previous decomposition is still valid.
+                auto const solverResult = (userData.decomposition_ != nullptr)
+                    ? data_.solver.run(structure.solverStructurePtr(), basisOf(userData), *userData.decomposition_, executor)
+                    : data_.solver.run(structure.solverStructurePtr(), basisOf(userData), executor);
+                auto const& solution = solverResult.solutionPtr();
+                userData.resolve(solution, solverResult.decompositionPtr(), statsOf(structure, solution.get()));
+            } else {
+                auto const solverResult = data_.solver.run(structure.solverStructurePtr(), executor);
+                auto const& solution = solverResult.solutionPtr();
+                userData.resolve(solution, solverResult.decompositionPtr(), statsOf(structure, solution.get()));
+            }
+        }
+
+        // nullptr if the structure is unsolved, or if its solve is deferred. An evicted solution is rebuilt.
+        [[nodiscard]]
+        Solution const* solutionOf(StructureIndex structureId, StructureUserData const& userData) {
+            if (userData.isPending() || userData.state_ != StructureState::Solved) {
+                return nullptr;
+            }
+            if (userData.isEvicted()) {
+                loadSolution(structureId);
+            }
+            return userData.solution_.get();
+        }
+
+        // Contacts of unsolved or deferred structures are ignored.
+        [[nodiscard]]
+        StressRatio stressRatioOf(SceneBlockReference const& block) {
+            auto const stressMax = block.maxPressureStress();
+            StressRatio result{ 0.f * u.one, 0.f * u.one, 0.f * u.one };
+            for (auto const& contact : block.contacts()) {
+                auto const structure = contact.structure();
+                Solution const* solution = solutionOf(structure.index(), structure.userData());
+                if (solution != nullptr) {
+                    result.mergeMax(ContactView{ contact.view(), solution }.pressureStress() / stressMax);
+                }
+            }
+            return result;
+        }
+
+        // solution: nullptr if the solver failed.
+        [[nodiscard]]
+        static StructureStats statsOf(SceneStructureReference const& structure, Solution const* solution) {
+            StructureStats result;
+            for (auto const& block : structure.blockViews()) {
+                result.addBlock(block.mass(), block.position());
+            }
+            if (solution != nullptr) {
+                for (auto const& sceneContact : structure.linkViews()) {
+                    result.addLink(sceneContact.index(), ContactView{ sceneContact, solution }.stressRatio());
+                }
+            }
+            return result;
+        }
+
+        // Does nothing if the solution cache is disabled.
+        void trackSolution(StructureIndex structureId, StructureUserData const& userData) {
+            auto& cache = data_.solutionCache;
+            if (!cache.isEnabled()) {
+                return;
+            }
+            if (userData.solution_ != nullptr) {
+                cache.insert(structureId, userData.solutionMemoryUsage());
+            } else {
+                cache.erase(structureId);
+            }
+        }
+
+        WorldData& data_;
+        ChangeRecord* changes_;
+        std::unordered_set<BlockIndex> visitedFoundations_;
+    };
+}
@@ -25,54 +25,183 @@
 
 #pragma once
 
+#include <cassert>
+#include <cstddef>
 #include <memory>
+#include <stdexcept>
 
 #include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/cfg/cUnitOf.hpp>
+#include <gustave/cfg/LibTraits.hpp>
 #include <gustave/core/solvers/Force1Solver.hpp>
 #include <gustave/core/worlds/syncWorld/StructureState.hpp>
+#include <gustave/core/worlds/syncWorld/StructureStats.hpp>
 #include <gustave/core/worlds/syncWorld/forwardDecls.hpp>
 #include <gustave/utils/Prop.hpp>
 
 namespace gustave::core::worlds::syncWorld::detail {
     template<cfg::cLibConfig auto libCfg_>
     class StructureUserData {
+    private:
+        static constexpr auto u = cfg::units(libCfg_);
+
+        template<cfg::cUnitOf<libCfg_> auto unit>
+        using Real = cfg::Real<libCfg_, unit>;
+
+        using StructureSolver = detail::StructureSolver<libCfg_>;
+        using WorldData = detail::WorldData<libCfg_>;
+
+        friend StructureSolver;
     public:
         using Solver = solvers::Force1Solver<libCfg_>;
         using State = StructureState;
+        using Stats = StructureStats<libCfg_>;
+        using StructureIndex = cfg::StructureIndex<libCfg_>;
 
+        using Basis = Solver::Basis;
+        using Decomposition = Solver::Decomposition;
         using Solution = Solver::Solution;
         using SolverStructure = Solver::Structure;
 
         [[nodiscard]]
         StructureUserData()
             : solution_{ nullptr }
+            , evictedBasis_{ nullptr }
+            , decomposition_{ nullptr }
+            , world_{ nullptr }
+            , index_{ 0 }
+            , priority_{ 0.f * u.one }
             , state_{ State::New }
+            , isPending_{ false }
         {}
 
+        // Links this structure to its world, which lazy solving and solution eviction go through.
+        void attach(WorldData& world, StructureIndex index) {
+            world_ = &world;
+            index_ = index;
+        }
+
+        // Lazy solving: the next call to solution(), solutionPtr(), state() or stats() solves this structure.
+        void defer(WorldData& world, StructureIndex index) {
+            attach(world, index);
+            isPending_ = true;
+        }
+
+        // Solved, but only the basis of its solution is kept: the next call to solution() or solutionPtr() rebuilds it.
+        [[nodiscard]]
+        bool isEvicted() const {
+            return evictedBasis_ != nullptr;
+        }
+
+        [[nodiscard]]
+        bool isPending() const {
+            return isPending_;
+        }
+
         [[nodiscard]]
         Solution const& solution() const {
+            solvePending();
             if (state_ != State::Solved) {
                 throw std::logic_error("The structure must be in the 'Solved' state.");
             }
+            loadSolution();
             return *solution_;
         }
 
-        void solve(std::shared_ptr<Solution const> solution) {
+        // Bytes accounted by the world's solution cache for this structure: its solution and decomposition.
+        [[nodiscard]]
+        std::size_t solutionMemoryUsage() const {
+            if (solution_ == nullptr) {
+                return 0;
+            }
+            std::size_t result = solution_->memoryUsage();
+            if (decomposition_ != nullptr) {
+                result += decomposition_->memoryUsage();
+            }
+            return result;
+        }
+
+        // nullptr unless the structure is in the 'Solved' state.
+        [[nodiscard]]
+        std::shared_ptr<Solution const> const& solutionPtr() const {
+            solvePending();
+            loadSolution();
+            return solution_;
+        }
+
+        // Pending structures with a higher priority are solved first.
+        [[nodiscard]]
+        Real<u.one> priority() const {
+            return priority_;
+        }
+
+        // Replaces the solution of a structure whose masses or conductivities were modified.
+        // decomposition: nullable. Reused by the next re-solve of this structure.
+        void resolve(std::shared_ptr<Solution const> solution, std::shared_ptr<Decomposition const> decomposition, Stats const& stats) {
+            assert(state_ != State::New);
+            setSolution(std::move(solution));
+            decomposition_ = std::move(decomposition);
+            stats_ = stats;
+        }
+
+        void setPriority(Real<u.one> value) {
+            priority_ = value;
+        }
+
+        // decomposition: nullable. Reused by the next re-solve of this structure.
+        void solve(std::shared_ptr<Solution const> solution, std::shared_ptr<Decomposition const> decomposition, Stats const& stats) {
             assert(state_ == State::New);
+            setSolution(std::move(solution));
+            decomposition_ = std::move(decomposition);
+            stats_ = stats;
+        }
+
+        [[nodiscard]]
+        State state() const {
+            solvePending();
+            return state_;
+        }
+
+        [[nodiscard]]
+        Stats const& stats() const {
+            solvePending();
+            return stats_;
+        }
+    private:
+        // Rebuilds an evicted solution, and marks it as recently used in the world's solution cache.
+        void loadSolution() const {
+            if (world_ != nullptr && (isEvicted() || world_->solutionCache.isEnabled())) {
+                StructureSolver{ *world_ }.loadSolution(index_);
+            }
+        }
+
+        void solvePending() const {
+            if (isPending_) {
+                StructureSolver{ *world_ }.run(index_);
+            }
+        }
+
+        void setSolution(std::shared_ptr<Solution const> solution) {
             if (solution != nullptr) {
                 solution_ = std::move(solution);
                 state_ = State::Solved;
             } else {
+                solution_ = nullptr;
                 state_ = State::Unsolvable;
             }
+            evictedBasis_ = nullptr;
+            isPending_ = false;
         }
 
-        [[nodiscard]]
-        State state() const {
-            return state_;
-        }
-    private:
         std::shared_ptr<Solution const> solution_;
+        std::shared_ptr<Basis const> evictedBasis_;
+        std::shared_ptr<Decomposition const> decomposition_;
+        Stats stats_;
+        // Not a utils::prop::Ptr: reading a deferred or evicted structure from a const reference updates it.
+        WorldData* world_;
+        StructureIndex index_;
+        Real<u.one> priority_;
         State state_;
+        bool isPending_;
     };
 }
@@ -26,11 +26,17 @@
 #pragma once
 
 #include <memory>
+#include <unordered_set>
+#include <utility>
 
 #include <gustave/cfg/cLibConfig.hpp>
 #include <gustave/core/scenes/CuboidGridScene.hpp>
+#include <gustave/core/worlds/syncWorld/detail/BlockUserData.hpp>
 #include <gustave/core/worlds/syncWorld/detail/CommonUserData.hpp>
+#include <gustave/core/worlds/syncWorld/detail/SnapshotCache.hpp>
+#include <gustave/core/worlds/syncWorld/detail/SolutionCache.hpp>
 #include <gustave/core/worlds/syncWorld/detail/StructureUserData.hpp>
+#include <gustave/core/worlds/syncWorld/SolveMode.hpp>
 #include <gustave/core/worlds/syncWorld/StructureState.hpp>
 
 namespace gustave::core::worlds::syncWorld::detail {
@@ -43,19 +49,34 @@ namespace gustave::core::worlds::syncWorld::detail {
         using Vector3 = cfg::Vector3<libCfg, unit>;
 
         struct SceneUserData {
-            using Block = void;
+            using Block = BlockUserData<libCfg>;
             using Common = CommonUserData<libCfg>;
             using Structure = StructureUserData<libCfg>;
         };
     public:
         using Scene = scenes::CuboidGridScene<libCfg, SceneUserData>;
+        using SnapshotCache = detail::SnapshotCache<libCfg>;
+        using SolutionCache = detail::SolutionCache<libCfg>;
+        using SolveMode = syncWorld::SolveMode;
         using Solver = SceneUserData::Structure::Solver;
+        using StructureIndex = Scene::StructureIndex;
         using StructureState = syncWorld::StructureState;
+        using Terrain = Scene::Terrain;
 
         [[nodiscard]]
         explicit WorldData(Vector3<u.length> const& blockSize, Solver solver_)
             : scene{ blockSize }
             , solver{ std::move(solver_) }
+            , solveMode{ SolveMode::Eager }
+        {
+            scene.userData().setWorld(*this);
+        }
+
+        [[nodiscard]]
+        explicit WorldData(Vector3<u.length> const& blockSize, Terrain terrain, Solver solver_)
+            : scene{ blockSize, std::move(terrain) }
+            , solver{ std::move(solver_) }
+            , solveMode{ SolveMode::Eager }
         {
             scene.userData().setWorld(*this);
         }
@@ -67,6 +88,10 @@ namespace gustave::core::worlds::syncWorld::detail {
         WorldData(WorldData&& other)
             : scene{ std::move(other.scene) }
             , solver{ std::move(other.solver) }
+            , snapshots{ std::move(other.snapshots) }
+            , pendingStructures{ std::move(other.pendingStructures) }
+            , solutionCache{ std::move(other.solutionCache) }
+            , solveMode{ other.solveMode }
         {
             resetWorldDataPtr();
         }
@@ -75,6 +100,10 @@ namespace gustave::core::worlds::syncWorld::detail {
             if (&other != this) {
                 scene = std::move(other.scene);
                 solver = std::move(other.solver);
+                snapshots = std::move(other.snapshots);
+                pendingStructures = std::move(other.pendingStructures);
+                solutionCache = std::move(other.solutionCache);
+                solveMode = other.solveMode;
                 resetWorldDataPtr();
             }
             return *this;
@@ -82,9 +111,17 @@ namespace gustave::core::worlds::syncWorld::detail {
 
         Scene scene;
         Solver solver;
+        SnapshotCache snapshots;
+        // Structures whose solve is deferred (lazy mode).
+        std::unordered_set<StructureIndex> pendingStructures;
+        SolutionCache solutionCache;
+        SolveMode solveMode;
     private:
         void resetWorldDataPtr() {
             scene.userData().setWorld(*this);
+            for (auto&& structure : scene.structures()) {
+                structure.userData().attach(*this, structure.index());
+            }
         }
     };
 }
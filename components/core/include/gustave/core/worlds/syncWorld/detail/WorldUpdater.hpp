@@ -25,15 +25,32 @@
 
 #pragma once
 
+#include <array>
 #include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <unordered_set>
+#include <vector>
 
 #include <gustave/cfg/cLibConfig.hpp>
+#include <gustave/core/worlds/syncWorld/detail/StructureSolver.hpp>
 #include <gustave/core/worlds/syncWorld/detail/WorldData.hpp>
+#include <gustave/core/worlds/syncWorld/ChangeRecord.hpp>
+#include <gustave/core/worlds/syncWorld/SolveMode.hpp>
+#include <gustave/utils/cExecutor.hpp>
+#include <gustave/utils/SerialExecutor.hpp>
 
 namespace gustave::core::worlds::syncWorld::detail {
     template<cfg::cLibConfig auto libCfg>
     class WorldUpdater {
+    private:
+        using BlockIndex = WorldData<libCfg>::Scene::BlockIndex;
+        using Direction = BlockIndex::Direction;
+        using StructureIndex = WorldData<libCfg>::Scene::StructureIndex;
+        using StructureSolver = detail::StructureSolver<libCfg>;
     public:
+        using ChangeRecord = syncWorld::ChangeRecord<libCfg>;
         using WorldData = detail::WorldData<libCfg>;
 
         using TransactionResult = WorldData::Scene::TransactionResult;
@@ -45,15 +62,207 @@ namespace gustave::core::worlds::syncWorld::detail {
         {}
 
         TransactionResult runTransaction(Transaction const& transaction) {
-            TransactionResult const result = data_.scene.modify(transaction);
+            utils::SerialExecutor executor;
+            return doRunTransaction(transaction, nullptr, executor);
+        }
+
+        TransactionResult runTransaction(Transaction const& transaction, utils::cExecutor auto& executor) {
+            return doRunTransaction(transaction, nullptr, executor);
+        }
+
+        // changes: cleared, then filled with the changes made by this transaction.
+        TransactionResult runTransaction(Transaction const& transaction, ChangeRecord& changes) {
+            utils::SerialExecutor executor;
+            return doRunTransaction(transaction, &changes, executor);
+        }
+
+        TransactionResult runTransaction(Transaction const& transaction, ChangeRecord& changes, utils::cExecutor auto& executor) {
+            return doRunTransaction(transaction, &changes, executor);
+        }
+
+        // Evicts solutions right away if the new budget is exceeded.
+        void setSolutionMemoryBudget(std::optional<std::size_t> budget) {
+            bool const wasEnabled = data_.solutionCache.isEnabled();
+            data_.solutionCache.setBudget(budget);
+            auto structureSolver = StructureSolver{ data_ };
+            if (!wasEnabled) {
+                structureSolver.trackSolutions();
+            }
+            structureSolver.evictOverBudget();
+        }
+
+        void solvePending() {
+            utils::SerialExecutor executor;
+            solvePending(executor);
+        }
+
+        void solvePending(utils::cExecutor auto& executor) {
+            auto structureSolver = StructureSolver{ data_ };
+            structureSolver.runPending(executor);
+            structureSolver.evictOverBudget();
+        }
+
+        // changes: the stress changes of the solved structures are appended to it.
+        void solvePending(ChangeRecord& changes) {
+            utils::SerialExecutor executor;
+            solvePending(changes, executor);
+        }
+
+        void solvePending(ChangeRecord& changes, utils::cExecutor auto& executor) {
+            auto structureSolver = StructureSolver{ data_, &changes };
+            structureSolver.runPending(executor);
+            structureSolver.evictOverBudget();
+        }
+
+        void solvePending(std::chrono::nanoseconds budget) {
+            utils::SerialExecutor executor;
+            auto structureSolver = StructureSolver{ data_ };
+            structureSolver.runPending(budget, executor);
+            structureSolver.evictOverBudget();
+        }
+
+        void solvePending(std::chrono::nanoseconds budget, ChangeRecord& changes) {
+            utils::SerialExecutor executor;
+            auto structureSolver = StructureSolver{ data_, &changes };
+            structureSolver.runPending(budget, executor);
+            structureSolver.evictOverBudget();
+        }
+    private:
+        TransactionResult doRunTransaction(Transaction const& transaction, ChangeRecord* changes, utils::cExecutor auto& executor) {
+            if (changes != nullptr) {
+                changes->clear();
+            }
+            std::vector<BlockIndex> const removedBlocks = removedBlocksOf(transaction);
+            TransactionResult const result = data_.scene.modify(transaction, executor);
+            for (auto const& structureId : result.deletedStructures()) {
+                data_.pendingStructures.erase(structureId);
+                data_.solutionCache.erase(structureId);
+            }
+            auto structureSolver = StructureSolver{ data_, changes };
+            std::vector<StructureIndex> const structureIds = updatedStructuresOf(result);
+            if (data_.solveMode == SolveMode::Lazy) {
+                deferStructures(structureIds);
+            } else {
+                structureSolver.run(structureIds, executor);
+            }
+            updateFoundationsAround(removedBlocks, structureSolver);
+            structureSolver.evictOverBudget();
+            invalidateSnapshot(transaction, result, removedBlocks);
+            if (changes != nullptr) {
+                recordBlocks(transaction, removedBlocks, *changes);
+                eraseAddedBlockStresses(*changes);
+                for (auto const& structureId : result.newStructures()) {
+                    changes->newStructures_.push_back(structureId);
+                }
+                changes->modifiedStructures_ = result.modifiedStructures();
+                changes->deletedStructures_ = result.deletedStructures();
+            }
+            return result;
+        }
+
+        void deferStructures(std::vector<StructureIndex> const& structureIds) {
+            for (StructureIndex const structureId : structureIds) {
+                data_.pendingStructures.insert(structureId);
+                data_.scene.structures().at(structureId).userData().defer(data_, structureId);
+            }
+        }
+
+        // Blocks added by the transaction had no previous stress ratio.
+        static void eraseAddedBlockStresses(ChangeRecord& changes) {
+            std::unordered_set<BlockIndex> const addedBlocks{ changes.addedBlocks_.begin(), changes.addedBlocks_.end() };
+            std::erase_if(changes.stressChanges_, [&](auto const& change) {
+                return addedBlocks.contains(change.index());
+            });
+        }
+
+        [[nodiscard]]
+        static std::vector<StructureIndex> updatedStructuresOf(TransactionResult const& result) {
+            std::vector<StructureIndex> structureIds;
             for (auto const& structureId : result.newStructures()) {
-                auto structure = data_.scene.structures().at(structureId);
-                auto const solverResult = data_.solver.run(structure.solverStructurePtr());
-                structure.userData().solve(solverResult.solutionPtr());
+                structureIds.push_back(structureId);
+            }
+            for (auto const& structureId : result.modifiedStructures()) {
+                structureIds.push_back(structureId);
+            }
+            return structureIds;
+        }
+
+        // Foundations that lost a neighbour in the transaction.
+        void updateFoundationsAround(std::vector<BlockIndex> const& removedBlocks, StructureSolver& structureSolver) {
+            static constexpr auto directions = std::array{
+                Direction::plusX(), Direction::minusX(), Direction::plusY(), Direction::minusY(), Direction::plusZ(), Direction::minusZ(),
+            };
+            for (BlockIndex const& removedIndex : removedBlocks) {
+                for (Direction const direction : directions) {
+                    if (auto const neighbourId = removedIndex.neighbourAlong(direction)) {
+                        auto neighbour = data_.scene.blocks().find(*neighbourId);
+                        if (neighbour.isValid() && neighbour.isFoundation()) {
+                            structureSolver.updateBlock(neighbour);
+                        }
+                    }
+                }
+            }
+        }
+
+        // Blocks of the solved structures are invalidated by the StructureSolver.
+        void invalidateSnapshot(Transaction const& transaction, TransactionResult const& result, std::vector<BlockIndex> const& removedBlocks) {
+            auto& snapshots = data_.snapshots;
+            if (!transaction.materialChanges().empty()) {
+                snapshots.invalidateAll();
+            }
+            for (BlockIndex const& index : removedBlocks) {
+                snapshots.invalidateBlock(index);
+            }
+            for (auto const& newBlock : transaction.newBlocks()) {
+                snapshots.invalidateBlock(newBlock.index());
+            }
+            for (auto const& fill : transaction.regionFills()) {
+                snapshots.invalidateRegion(fill.region());
+            }
+            for (auto const& modification : transaction.modifiedBlocks()) {
+                snapshots.invalidateBlock(modification.index());
+            }
+            for (auto const& structureId : result.newStructures()) {
+                snapshots.invalidateStructure(structureId);
+            }
+            for (auto const& structureId : result.modifiedStructures()) {
+                snapshots.invalidateStructure(structureId);
+            }
+            for (auto const& structureId : result.deletedStructures()) {
+                snapshots.invalidateStructure(structureId);
+            }
+        }
+
+        void recordBlocks(Transaction const& transaction, std::vector<BlockIndex> const& removedBlocks, ChangeRecord& changes) {
+            changes.removedBlocks_ = removedBlocks;
+            for (auto const& newBlock : transaction.newBlocks()) {
+                changes.addedBlocks_.push_back(newBlock.index());
+            }
+            for (auto const& fill : transaction.regionFills()) {
+                for (auto const& block : data_.scene.blocks().inRegion(fill.region())) {
+                    if (fill.isOccupied(block.index())) {
+                        changes.addedBlocks_.push_back(block.index());
+                    }
+                }
+            }
+        }
+
+        // Cleared regions can overlap each other, and the deleted blocks.
+        [[nodiscard]]
+        std::vector<BlockIndex> removedBlocksOf(Transaction const& transaction) const {
+            auto const& deletedBlocks = transaction.deletedBlocks();
+            std::vector<BlockIndex> result{ deletedBlocks.begin(), deletedBlocks.end() };
+            std::unordered_set<BlockIndex> clearedBlocks;
+            for (auto const& region : transaction.clearedRegions()) {
+                for (auto const& block : data_.scene.blocks().inRegion(region)) {
+                    if (!deletedBlocks.contains(block.index()) && clearedBlocks.insert(block.index()).second) {
+                        result.push_back(block.index());
+                    }
+                }
             }
             return result;
         }
-    private:
+
         WorldData& data_;
     };
 }
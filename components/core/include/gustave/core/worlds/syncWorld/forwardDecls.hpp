@@ -33,11 +33,20 @@ namespace gustave::core::worlds::syncWorld {
         template<cfg::cLibConfig auto>
         class CommonUserData;
 
+        template<cfg::cLibConfig auto>
+        class SnapshotBuilder;
+
+        template<cfg::cLibConfig auto>
+        class StructureSolver;
+
         template<cfg::cLibConfig auto>
         class StructureUserData;
 
         template<cfg::cLibConfig auto>
         struct WorldData;
+
+        template<cfg::cLibConfig auto>
+        class WorldUpdater;
     }
 
     template<cfg::cLibConfig auto>
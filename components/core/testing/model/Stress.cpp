@@ -62,6 +62,17 @@ TEST_CASE("core::model::Stress") {
         }
     }
 
+    SECTION(".checkStrictlyPositive()") {
+        SECTION("// valid") {
+            CHECK_NOTHROW(concrete_20m.checkStrictlyPositive("stress"));
+        }
+
+        SECTION("// invalid shear") {
+            PressureStress const stress{ 1000.f * u.pressure, 0.f * u.pressure, 1000.f * u.pressure };
+            CHECK_THROWS_AS(stress.checkStrictlyPositive("stress"), std::invalid_argument);
+        }
+    }
+
     SECTION("::minStress(PressureStress const&, PressureStress const&)") {
         PressureStress const m1{
             4.f * u.pressure, // compressive
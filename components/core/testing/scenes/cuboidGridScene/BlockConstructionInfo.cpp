@@ -45,6 +45,12 @@ TEST_CASE("core::scenes::cuboidGridScene::BlockConstructionInfo") {
             CHECK(obj.maxPressureStress().tensile() == concrete_20m.tensile());
             CHECK(obj.mass() == 5.f * u.mass);
             CHECK(obj.isFoundation() == true);
+            CHECK(obj.materialId() == 0);
+        }
+
+        SECTION("// material id") {
+            const BlockConstructionInfo obj{ {4,5,6}, concrete_20m, 5.f * u.mass, true, 7 };
+            CHECK(obj.materialId() == 7);
         }
 
         SECTION("// constructor: invalid mass") {
@@ -23,9 +23,20 @@
  * SOFTWARE.
  */
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <gustave/core/scenes/cuboidGridScene/BlockIndex.hpp>
+#include <gustave/utils/FlatHashMap.hpp>
+#include <gustave/utils/Hasher.hpp>
 
 #include <TestConfig.hpp>
 
@@ -107,4 +118,82 @@ TEST_CASE("core::scenes::cuboidGridScene::BlockIndex") {
         BlockIndex expected = { 7, 6, 2 };
         CHECK(lhs + rhs == expected);
     }
+
+    SECTION("::Hasher") {
+        auto const hasher = BlockIndex::Hasher{};
+        CHECK(hasher({ 2,4,7 }) != hasher({ 3,4,7 }));
+        CHECK(hasher({ 2,4,7 }) != hasher({ 2,5,7 }));
+        CHECK(hasher({ 2,4,7 }) != hasher({ 2,4,8 }));
+        CHECK(hasher({ 2,4,7 }) != hasher({ 7,4,2 }));
+
+        SECTION("// low bits of a dense box") {
+            std::unordered_set<std::size_t> lowBits;
+            for (Coord x = -8; x < 8; ++x) {
+                for (Coord y = -8; y < 8; ++y) {
+                    for (Coord z = -8; z < 8; ++z) {
+                        lowBits.insert(hasher({ x,y,z }) & 0xFFF);
+                    }
+                }
+            }
+            // 4096 indices into 4096 buckets: a uniform hash fills ~63% of them.
+            CHECK(lowBits.size() > 2400);
+        }
+    }
+}
+
+TEST_CASE("core::scenes::cuboidGridScene::BlockIndex - benchmark", "[.][benchmark]") {
+    using NodeIndex = std::uint32_t;
+    using LegacyHasher = gustave::utils::Hasher<BlockIndex, &BlockIndex::x, &BlockIndex::y, &BlockIndex::z>;
+    using LegacyMap = std::unordered_map<BlockIndex, NodeIndex, LegacyHasher>;
+    using FlatMap = gustave::utils::FlatHashMap<BlockIndex, NodeIndex, BlockIndex::Hasher>;
+
+    // 50k blocks.
+    std::vector<BlockIndex> indices;
+    for (Coord x = 0; x < 50; ++x) {
+        for (Coord y = 0; y < 20; ++y) {
+            for (Coord z = 0; z < 50; ++z) {
+                indices.push_back({ x,y,z });
+            }
+        }
+    }
+
+    auto build = [&]<typename Map>() {
+        Map result;
+        for (std::size_t id = 0; id < indices.size(); ++id) {
+            result.insert({ indices[id], NodeIndex(id) });
+        }
+        return result;
+    };
+
+    // Lookups in random order: structures are queried by the world in arbitrary order.
+    auto shuffledIndices = indices;
+    std::shuffle(shuffledIndices.begin(), shuffledIndices.end(), std::mt19937{ 42 });
+
+    auto sumLookups = [&](auto const& map) {
+        std::size_t result = 0;
+        for (auto const& index : shuffledIndices) {
+            result += map.find(index)->second;
+        }
+        return result;
+    };
+
+    BENCHMARK("build: std::unordered_map + utils::Hasher") {
+        return build.operator()<LegacyMap>().size();
+    };
+
+    BENCHMARK("build: utils::FlatHashMap + BlockIndex::Hasher") {
+        return build.operator()<FlatMap>().size();
+    };
+
+    auto const legacyMap = build.operator()<LegacyMap>();
+    auto const flatMap = build.operator()<FlatMap>();
+    REQUIRE(sumLookups(legacyMap) == sumLookups(flatMap));
+
+    BENCHMARK("lookup: std::unordered_map + utils::Hasher") {
+        return sumLookups(legacyMap);
+    };
+
+    BENCHMARK("lookup: utils::FlatHashMap + BlockIndex::Hasher") {
+        return sumLookups(flatMap);
+    };
 }
@@ -0,0 +1,61 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdexcept>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <gustave/core/scenes/cuboidGridScene/BlockIndex.hpp>
+#include <gustave/core/scenes/cuboidGridScene/BlockModification.hpp>
+
+#include <TestHelpers.hpp>
+
+namespace cuboid = ::gustave::core::scenes::cuboidGridScene;
+
+using BlockIndex = cuboid::BlockIndex;
+using BlockModification = cuboid::BlockModification<libCfg>;
+
+TEST_CASE("core::scenes::cuboidGridScene::BlockModification") {
+    SECTION("// constructor") {
+        SECTION("// valid constructor & getters") {
+            BlockModification const obj{ {4,5,6}, concrete_40m, 5.f * u.mass };
+            CHECK(obj.index() == BlockIndex{ 4,5,6 });
+            CHECK(obj.maxPressureStress() == concrete_40m);
+            CHECK(obj.mass() == 5.f * u.mass);
+        }
+
+        SECTION("// invalid mass") {
+            CHECK_THROWS_AS((BlockModification{ {4,5,6}, concrete_20m, 0.f * u.mass }), std::invalid_argument);
+        }
+
+        SECTION("// invalid maxPressureStress") {
+            auto const zero = 0.f * u.pressure;
+            auto const one = 1000.f * u.pressure;
+            CHECK_THROWS_AS((BlockModification{ {0,0,0}, PressureStress{ zero, one, one }, 1.f * u.mass }), std::invalid_argument);
+            CHECK_THROWS_AS((BlockModification{ {0,0,0}, PressureStress{ one, zero, one }, 1.f * u.mass }), std::invalid_argument);
+            CHECK_THROWS_AS((BlockModification{ {0,0,0}, PressureStress{ one, one, zero }, 1.f * u.mass }), std::invalid_argument);
+        }
+    }
+}
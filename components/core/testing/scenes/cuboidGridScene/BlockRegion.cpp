@@ -0,0 +1,88 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <sstream>
+#include <stdexcept>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <gustave/core/scenes/cuboidGridScene/BlockRegion.hpp>
+
+#include <TestConfig.hpp>
+
+using BlockIndex = gustave::core::scenes::cuboidGridScene::BlockIndex;
+using BlockRegion = gustave::core::scenes::cuboidGridScene::BlockRegion;
+
+TEST_CASE("core::scenes::cuboidGridScene::BlockRegion") {
+    auto const region = BlockRegion{ { 1,2,3 }, { 2,4,6 } };
+
+    SECTION("// constructor") {
+        CHECK(region.minIndex() == BlockIndex{ 1,2,3 });
+        CHECK(region.maxIndex() == BlockIndex{ 2,4,6 });
+        CHECK_THROWS_AS((BlockRegion{ { 1,2,3 }, { 2,1,6 } }), std::invalid_argument);
+    }
+
+    SECTION(".contains()") {
+        CHECK(region.contains({ 1,2,3 }));
+        CHECK(region.contains({ 2,4,6 }));
+        CHECK(region.contains({ 2,3,5 }));
+        CHECK_FALSE(region.contains({ 0,3,5 }));
+        CHECK_FALSE(region.contains({ 2,5,5 }));
+        CHECK_FALSE(region.contains({ 2,3,7 }));
+    }
+
+    SECTION(".intersection()") {
+        SECTION("// overlapping") {
+            auto const result = region.intersection(BlockRegion{ { 2,0,5 }, { 8,3,9 } });
+            REQUIRE(result);
+            CHECK(*result == BlockRegion{ { 2,2,5 }, { 2,3,6 } });
+        }
+
+        SECTION("// disjoint") {
+            CHECK_FALSE(region.intersection(BlockRegion{ { 3,2,3 }, { 4,4,6 } }));
+        }
+    }
+
+    SECTION(".localIdOf()") {
+        CHECK(region.localIdOf({ 1,2,3 }) == 0);
+        CHECK(region.localIdOf({ 2,2,3 }) == 1);
+        CHECK(region.localIdOf({ 1,3,3 }) == 2);
+        CHECK(region.localIdOf({ 1,2,4 }) == 6);
+        CHECK(region.localIdOf({ 2,4,6 }) == 23);
+    }
+
+    SECTION(".sizeX() // & sizeY() & sizeZ() & volume()") {
+        CHECK(region.sizeX() == 2);
+        CHECK(region.sizeY() == 3);
+        CHECK(region.sizeZ() == 4);
+        CHECK(region.volume() == 24);
+    }
+
+    SECTION("operator<<(std::ostream&, BlockRegion const&)") {
+        std::stringstream stream;
+        stream << BlockRegion{ { 1,2,3 }, { 4,5,6 } };
+        CHECK(stream.str() == R"({ "minIndex": { "x": 1, "y": 2, "z": 3 }, "maxIndex": { "x": 4, "y": 5, "z": 6 } })");
+    }
+}
@@ -137,6 +137,37 @@ TEST_CASE("core::scenes::cuboidGridScene::Blocks") {
         }
     }
 
+    SECTION(".inRegion()") {
+        auto runTest = [&](auto&& blocks, bool expectedConst) {
+            auto result = blocks.inRegion({ {0,1,0}, {5,5,5} });
+            auto const expectedIds = std::array{ BlockIndex{0,1,0}, BlockIndex{0,2,0} };
+            auto ids = result | std::views::transform([](auto&& b) { return b.index(); });
+            REQUIRE_THAT(ids, matchers::c2::UnorderedRangeEquals(expectedIds));
+            CHECK(expectedConst == result[0].userData().isCalledAsConst());
+        };
+
+        SECTION("// mutable") {
+            runTest(mBlocks, false);
+        }
+
+        SECTION("// const") {
+            runTest(cmBlocks, true);
+        }
+
+        SECTION("// immutable") {
+            runTest(iBlocks, true);
+        }
+
+        SECTION("// after removal") {
+            Transaction t2;
+            t2.removeBlock({ 0,2,0 });
+            SceneUpdater{ scene }.runTransaction(t2);
+            auto const result = iBlocks.inRegion({ {0,1,0}, {5,5,5} });
+            REQUIRE(result.size() == 1);
+            CHECK(result[0].index() == BlockIndex{ 0,1,0 });
+        }
+    }
+
     SECTION(".size()") {
         CHECK(iBlocks.size() == 3);
     }
@@ -113,6 +113,15 @@ TEST_CASE("core::scenes::cuboidGridScene::ContactReference") {
 
     auto invalidContact = immContactRef({ 0,0,0 }, Direction::minusZ());
 
+    auto terrainScene = SceneData{ blockSize, SceneData::Terrain::heightField([](auto, auto) { return 0; }, concrete_40m) };
+    {
+        Transaction t;
+        t.addBlock({ {0,0,0}, concrete_20m, 1000.f * u.mass, false });
+        t.addBlock({ {1,0,0}, concrete_20m, 1000.f * u.mass, true });
+        SceneUpdater{ terrainScene }.runTransaction(t);
+    }
+    auto groundContact = ContactReference<false>{ terrainScene, { {0,0,0}, Direction::minusY() } };
+
     SECTION(".area()") {
         SECTION("// valid") {
             CHECK(iContact222minusX.area() == 3.f * u.area);
@@ -164,7 +173,34 @@ TEST_CASE("core::scenes::cuboidGridScene::ContactReference") {
         CHECK(iContact222minusX.index() == expected);
     }
 
+    SECTION(".isGroundContact()") {
+        SECTION("// true") {
+            CHECK(groundContact.isGroundContact());
+        }
+
+        SECTION("// false") {
+            CHECK_FALSE(iContact222minusX.isGroundContact());
+            CHECK_FALSE(ContactReference<false>{ terrainScene, { {0,0,0}, Direction::plusX() } }.isGroundContact());
+        }
+
+        SECTION("// invalid") {
+            CHECK_THROWS_AS(invalidContact.isGroundContact(), std::out_of_range);
+        }
+    }
+
     SECTION(".isValid()") {
+        SECTION("// true: ground contact") {
+            CHECK(groundContact.isValid());
+        }
+
+        SECTION("// false: no ground") {
+            CHECK_FALSE(ContactReference<false>{ terrainScene, { {0,0,0}, Direction::plusY() } }.isValid());
+        }
+
+        SECTION("// false: foundation on the ground") {
+            CHECK_FALSE(ContactReference<false>{ terrainScene, { {1,0,0}, Direction::minusY() } }.isValid());
+        }
+
         SECTION("// true") {
             CHECK(iContact222minusX.isValid());
         }
@@ -224,6 +260,10 @@ TEST_CASE("core::scenes::cuboidGridScene::ContactReference") {
     }
 
     SECTION(".maxPressureStress()") {
+        SECTION("// ground contact") {
+            CHECK(groundContact.maxPressureStress() == concrete_20m);
+        }
+
         SECTION("// valid") {
             CHECK(iContact222minusX.maxPressureStress() == PressureStress::minStress(concrete_20m, highTensile));
         }
@@ -271,6 +311,10 @@ TEST_CASE("core::scenes::cuboidGridScene::ContactReference") {
             runValidTest(iContact222minusX, true);
         }
 
+        SECTION("// ground contact") {
+            CHECK_FALSE(groundContact.opposite().isValid());
+        }
+
         SECTION("// invalid") {
             CHECK_THROWS_AS(invalidContact.opposite(), std::out_of_range);
         }
@@ -300,6 +344,10 @@ TEST_CASE("core::scenes::cuboidGridScene::ContactReference") {
             runValidTest(iContact222minusX, true);
         }
 
+        SECTION("// ground contact") {
+            CHECK_FALSE(groundContact.otherBlock().isValid());
+        }
+
         SECTION("// invalid") {
             CHECK_THROWS_AS(invalidContact.otherBlock(), std::out_of_range);
         }
@@ -327,6 +375,16 @@ TEST_CASE("core::scenes::cuboidGridScene::ContactReference") {
             }
         };
 
+        SECTION("// ground contact") {
+            auto const& groundStructure = terrainScene.structures.at(terrainScene.blocks.at({ 0,0,0 }).structureId());
+            auto const result = groundContact.solverIndex();
+            CHECK(result.linkIndex == groundStructure.groundLinkIndices().at({ 0,0,0 }));
+            CHECK(result.isOnLocalNode);
+            auto const& solverLink = groundStructure.solverStructure().links().at(result.linkIndex);
+            CHECK(solverLink.localNodeId() == groundStructure.solverIndices().at({ 0,0,0 }));
+            CHECK(solverLink.otherNodeId() == *groundStructure.groundNodeIndex());
+        }
+
         SECTION("// direction: plusX") {
             checkContact({ 6,7,7 }, Direction::plusX());
         }
@@ -93,5 +93,21 @@ TEST_CASE("core::scenes::cuboidGridScene::Links") {
         SECTION("// immutable") {
             runTest(iLinks, true);
         }
+
+        SECTION("// ground contacts") {
+            SceneData terrainScene{ vector3(1.f, 2.f, 3.f, u.length), SceneData::Terrain::heightField([](auto, auto) { return 0; }, concrete_20m) };
+            t.clear();
+            t.addBlock({ {0,0,0}, concrete_20m, 1000.f * u.mass, false });
+            t.addBlock({ {0,1,0}, concrete_20m, 1000.f * u.mass, false });
+            t.addBlock({ {1,0,0}, concrete_20m, 1000.f * u.mass, true });
+            SceneUpdater{ terrainScene }.runTransaction(t);
+
+            auto const expected = std::array{
+                ContactReference<false>{ terrainScene, { {0,0,0}, Direction::plusX() } },
+                ContactReference<false>{ terrainScene, { {0,0,0}, Direction::plusY() } },
+                ContactReference<false>{ terrainScene, { {0,0,0}, Direction::minusY() } },
+            };
+            CHECK_THAT(Links<false>{ terrainScene }, matchers::c2::UnorderedRangeEquals(expected));
+        }
     }
 }
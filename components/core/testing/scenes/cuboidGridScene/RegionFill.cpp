@@ -0,0 +1,76 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <gustave/core/scenes/cuboidGridScene/RegionFill.hpp>
+
+#include <TestHelpers.hpp>
+
+namespace cuboid = gustave::core::scenes::cuboidGridScene;
+
+using BlockIndex = cuboid::BlockIndex;
+using BlockRegion = cuboid::BlockRegion;
+using RegionFill = cuboid::RegionFill<libCfg>;
+
+TEST_CASE("core::scenes::cuboidGridScene::RegionFill") {
+    auto const region = BlockRegion{ { 0,0,0 }, { 1,1,0 } };
+
+    SECTION("// full region") {
+        auto const fill = RegionFill{ region, concrete_20m, 5.f * u.mass, true };
+        CHECK(fill.isFull());
+        CHECK(fill.blockCount() == 4);
+        CHECK(fill.isFoundation());
+        CHECK(fill.mass() == 5.f * u.mass);
+        CHECK(fill.isOccupied({ 1,1,0 }));
+        CHECK_FALSE(fill.isOccupied({ 2,1,0 }));
+
+        auto const info = fill.blockAt({ 1,0,0 });
+        CHECK(info.index() == BlockIndex{ 1,0,0 });
+        CHECK(info.mass() == 5.f * u.mass);
+        CHECK(info.isFoundation());
+        CHECK(info.materialId() == 0);
+    }
+
+    SECTION("// occupancy array") {
+        auto const fill = RegionFill{ region, { true, false, false, true }, concrete_20m, 5.f * u.mass, false, 3 };
+        CHECK_FALSE(fill.isFull());
+        CHECK(fill.materialId() == 3);
+        CHECK(fill.blockAt({ 1,1,0 }).materialId() == 3);
+        CHECK(fill.blockCount() == 2);
+        CHECK(fill.isOccupied({ 0,0,0 }));
+        CHECK_FALSE(fill.isOccupied({ 1,0,0 }));
+        CHECK_FALSE(fill.isOccupied({ 0,1,0 }));
+        CHECK(fill.isOccupied({ 1,1,0 }));
+    }
+
+    SECTION("// invalid") {
+        CHECK_THROWS_AS((RegionFill{ region, { true, false }, concrete_20m, 5.f * u.mass, false }), std::invalid_argument);
+        CHECK_THROWS_AS((RegionFill{ region, concrete_20m, -5.f * u.mass, false }), std::invalid_argument);
+    }
+}
@@ -163,6 +163,38 @@ TEST_CASE("core::scenes::cuboidGridScene::Structures") {
         }
     }
 
+    SECTION(".intersecting()") {
+        auto runTest = [&](auto&& structs, bool expectedConst) {
+            auto result = structs.intersecting({ {0,0,0}, {5,1,0} });
+            auto const expectedIds = std::array{ structureIdOf({0,2,0}), structureIdOf({5,2,0}) };
+            auto ids = result | std::views::transform([](auto&& s) { return s.index(); });
+            REQUIRE_THAT(ids, matchers::c2::UnorderedRangeEquals(expectedIds));
+            CHECK(expectedConst == result[0].userData().isCalledAsConst());
+        };
+
+        SECTION("// mutable") {
+            runTest(mStructs, false);
+        }
+
+        SECTION("// const") {
+            runTest(cmStructs, true);
+        }
+
+        SECTION("// immutable") {
+            runTest(iStructs, true);
+        }
+
+        SECTION("// single structure") {
+            auto const result = iStructs.intersecting({ {4,2,0}, {6,2,0} });
+            REQUIRE(result.size() == 1);
+            CHECK(result[0].index() == structureIdOf({ 5,2,0 }));
+        }
+
+        SECTION("// empty") {
+            CHECK(iStructs.intersecting({ {1,0,0}, {4,9,9} }).empty());
+        }
+    }
+
     SECTION(".size()") {
         CHECK(mStructs.size() == 2);
     }
@@ -0,0 +1,65 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdexcept>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <gustave/core/scenes/cuboidGridScene/Terrain.hpp>
+
+#include <TestHelpers.hpp>
+
+namespace cuboid = gustave::core::scenes::cuboidGridScene;
+
+using BlockIndex = cuboid::BlockIndex;
+using Terrain = cuboid::Terrain<libCfg>;
+
+TEST_CASE("core::scenes::cuboidGridScene::Terrain") {
+    SECTION("// predicate") {
+        auto const terrain = Terrain{ [](BlockIndex const& index) { return index.x == 3; }, concrete_20m };
+        CHECK(terrain.isGround({ 3,7,-2 }));
+        CHECK_FALSE(terrain.isGround({ 2,7,-2 }));
+        CHECK(terrain.maxPressureStress() == concrete_20m);
+    }
+
+    SECTION("::heightField()") {
+        auto const terrain = Terrain::heightField([](Terrain::Coord x, Terrain::Coord) { return x; }, concrete_20m);
+        CHECK(terrain.isGround({ 2,1,5 }));
+        CHECK_FALSE(terrain.isGround({ 2,2,5 }));
+        CHECK(terrain.isGround({ -1,-2,0 }));
+        CHECK_FALSE(terrain.isGround({ -1,-1,0 }));
+    }
+
+    SECTION("// invalid constructor arguments") {
+        auto const zero = 0.f * u.pressure;
+        auto const one = 1000.f * u.pressure;
+        auto const isGround = [](BlockIndex const&) { return false; };
+        CHECK_THROWS_AS(Terrain(Terrain::Predicate{}, concrete_20m), std::invalid_argument);
+        CHECK_THROWS_AS(Terrain::heightField({}, concrete_20m), std::invalid_argument);
+        CHECK_THROWS_AS(Terrain(isGround, PressureStress{ zero, one, one }), std::invalid_argument);
+        CHECK_THROWS_AS(Terrain(isGround, PressureStress{ one, zero, one }), std::invalid_argument);
+        CHECK_THROWS_AS(Terrain(isGround, PressureStress{ one, one, zero }), std::invalid_argument);
+    }
+}
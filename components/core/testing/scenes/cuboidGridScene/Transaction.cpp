@@ -34,13 +34,22 @@
 namespace cuboid = gustave::core::scenes::cuboidGridScene;
 
 using BlockConstructionInfo = cuboid::BlockConstructionInfo<libCfg>;
+using BlockModification = cuboid::BlockModification<libCfg>;
 using BlockIndex = cuboid::BlockIndex;
+using BlockRegion = cuboid::BlockRegion;
 using Transaction = cuboid::Transaction<libCfg>;
 
+using MaterialChange = Transaction::MaterialChange;
+using RegionFill = Transaction::RegionFill;
+
 TEST_CASE("core::scenes::cuboidGridScene::Transaction") {
     Transaction transaction;
     auto const& newBlocks = transaction.newBlocks();
     auto const& deletedBlocks = transaction.deletedBlocks();
+    auto const& clearedRegions = transaction.clearedRegions();
+    auto const& regionFills = transaction.regionFills();
+    auto const& materialChanges = transaction.materialChanges();
+    auto const& modifiedBlocks = transaction.modifiedBlocks();
 
     SECTION(".addBlock(BlockConstructionInfo const&)") {
         BlockConstructionInfo const new1{ {2,4,6}, concrete_20m, 2.f * u.mass, true };
@@ -61,6 +70,24 @@ TEST_CASE("core::scenes::cuboidGridScene::Transaction") {
         }
     }
 
+    SECTION(".modifyBlock(BlockModification const&)") {
+        BlockModification const mod1{ {2,4,6}, concrete_40m, 2.f * u.mass };
+        transaction.modifyBlock(mod1);
+        transaction.modifyBlock({ {2,4,7}, concrete_20m, 3.f * u.mass });
+
+        BlockModification const dup1{ {2,4,6}, concrete_20m, 8.f * u.mass };
+
+        SECTION("// valid") {
+            auto it = modifiedBlocks.find(dup1);
+            REQUIRE(it != modifiedBlocks.end());
+            CHECK(*it == mod1);
+        }
+
+        SECTION("// duplicate") {
+            CHECK_THROWS_AS(transaction.modifyBlock(dup1), std::invalid_argument);
+        }
+    }
+
     SECTION(".removeBlock(BlockIndex const&)") {
         transaction.removeBlock({ 1,1,5 });
         transaction.removeBlock({ 2,1,5 });
@@ -68,13 +95,44 @@ TEST_CASE("core::scenes::cuboidGridScene::Transaction") {
         CHECK(deletedBlocks.contains({ 1,1,5 }));
     }
 
+    SECTION(".clearRegion(BlockRegion const&)") {
+        transaction.clearRegion(BlockRegion{ {0,0,0}, {4,4,4} });
+
+        REQUIRE(clearedRegions.size() == 1);
+        CHECK(clearedRegions[0] == BlockRegion{ {0,0,0}, {4,4,4} });
+    }
+
+    SECTION(".fillRegion(RegionFill const&)") {
+        transaction.fillRegion(RegionFill{ BlockRegion{ {0,0,0}, {1,1,1} }, concrete_20m, 2.f * u.mass, false });
+
+        REQUIRE(regionFills.size() == 1);
+        CHECK(regionFills[0].region() == BlockRegion{ {0,0,0}, {1,1,1} });
+    }
+
+    SECTION(".changeMaterial(MaterialChange const&)") {
+        transaction.changeMaterial(MaterialChange{ 3, concrete_40m, 2.f * u.one });
+
+        REQUIRE(materialChanges.size() == 1);
+        CHECK(materialChanges[0].materialId() == 3);
+        CHECK(materialChanges[0].newMaxPressureStress() == concrete_40m);
+        CHECK(materialChanges[0].massFactor() == 2.f * u.one);
+    }
+
     SECTION(".clear()") {
         transaction.addBlock({ {2,4,6}, concrete_20m, 2.f * u.mass, true });
         transaction.removeBlock({5,5,5});
+        transaction.clearRegion(BlockRegion{ {0,0,0}, {4,4,4} });
+        transaction.fillRegion(RegionFill{ BlockRegion{ {0,0,0}, {1,1,1} }, concrete_20m, 2.f * u.mass, false });
+        transaction.changeMaterial(MaterialChange{ 3, concrete_40m });
+        transaction.modifyBlock({ {2,4,6}, concrete_40m, 2.f * u.mass });
 
         transaction.clear();
 
         CHECK(newBlocks.empty());
         CHECK(deletedBlocks.empty());
+        CHECK(clearedRegions.empty());
+        CHECK(regionFills.empty());
+        CHECK(materialChanges.empty());
+        CHECK(modifiedBlocks.empty());
     }
 }
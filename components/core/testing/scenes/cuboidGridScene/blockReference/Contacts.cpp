@@ -134,5 +134,21 @@ TEST_CASE("core::scenes::cuboidGridScene::blockReference::Contacts") {
         SECTION("// empty") {
             CHECK(mContacts009.begin() == mContacts009.end());
         }
+
+        SECTION("// ground contacts") {
+            SceneData terrainScene{ blockSize, SceneData::Terrain::heightField([](auto, auto) { return 0; }, concrete_20m) };
+            t.clear();
+            newBlock({ 0,0,0 }, false);
+            newBlock({ 1,0,0 }, false);
+            SceneUpdater{ terrainScene }.runTransaction(t);
+
+            auto const contacts = Contacts<false>{ terrainScene.blocks.at({0,0,0}) };
+            auto expectedIds = std::array{
+                contactId({0,0,0}, Direction::plusX()),
+                contactId({0,0,0}, Direction::minusY()),
+            };
+            auto ids = contacts | std::views::transform([](auto&& contact) { return contact.index(); });
+            CHECK_THAT(ids, matchers::c2::UnorderedRangeEquals(expectedIds));
+        }
     }
 }
@@ -0,0 +1,113 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <gustave/core/scenes/cuboidGridScene/detail/BlockChunks.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/SceneData.hpp>
+
+#include <SceneUserData.hpp>
+#include <TestHelpers.hpp>
+
+namespace cuboid = gustave::core::scenes::cuboidGridScene;
+
+using BlockChunks = cuboid::detail::BlockChunks<libCfg, SceneUserData>;
+using BlockData = BlockChunks::BlockData;
+using BlockConstructionInfo = BlockData::BlockConstructionInfo;
+using BlockIndex = cuboid::BlockIndex;
+using BlockRegion = cuboid::BlockRegion;
+using SceneData = BlockData::SceneData;
+
+TEST_CASE("core::scenes::cuboidGridScene::detail::BlockChunks") {
+    auto scene = SceneData{ vector3(1.f, 1.f, 1.f, u.length) };
+    auto makeBlock = [&](BlockIndex const& index) {
+        return BlockData{ BlockConstructionInfo{ index, concrete_20m, 5.f * u.mass, false }, scene };
+    };
+    auto b000 = makeBlock({ 0,0,0 });
+    auto b15_0_0 = makeBlock({ 15,0,0 });
+    auto b16_0_0 = makeBlock({ 16,0,0 });
+    auto bm1_0_0 = makeBlock({ -1,0,0 });
+    auto b0_m17_40 = makeBlock({ 0,-17,40 });
+
+    BlockChunks chunks;
+    for (BlockData* block : { &b000, &b15_0_0, &b16_0_0, &bm1_0_0, &b0_m17_40 }) {
+        chunks.insert(*block);
+    }
+
+    auto blocksIn = [&](BlockRegion const& region) {
+        std::vector<BlockIndex> result;
+        chunks.forEachIn(region, [&](BlockData const& block) {
+            result.push_back(block.index());
+        });
+        return result;
+    };
+
+    SECTION(".chunkCount()") {
+        CHECK(chunks.chunkCount() == 4);
+    }
+
+    SECTION(".erase()") {
+        chunks.erase(b000);
+        CHECK(chunks.chunkCount() == 4);
+        chunks.erase(b15_0_0);
+        CHECK(chunks.chunkCount() == 3);
+        auto const expected = std::vector<BlockIndex>{ {16,0,0} };
+        CHECK_THAT(blocksIn({ {0,0,0}, {16,0,0} }), matchers::c2::UnorderedRangeEquals(expected));
+    }
+
+    SECTION(".forEachIn()") {
+        SECTION("// small region") {
+            auto const expected = std::vector<BlockIndex>{ {-1,0,0}, {0,0,0}, {15,0,0} };
+            CHECK_THAT(blocksIn({ {-1,0,0}, {15,0,0} }), matchers::c2::UnorderedRangeEquals(expected));
+        }
+
+        SECTION("// large region") {
+            auto const expected = std::vector<BlockIndex>{ {0,-17,40}, {0,0,0}, {15,0,0}, {16,0,0} };
+            CHECK_THAT(blocksIn({ {0,-1000,-1000}, {1000,1000,1000} }), matchers::c2::UnorderedRangeEquals(expected));
+        }
+
+        SECTION("// empty") {
+            CHECK(blocksIn({ {1,0,0}, {14,15,15} }).empty());
+        }
+
+        SECTION("// huge region (volume overflow)") {
+            static constexpr auto coordMax = std::numeric_limits<BlockIndex::Coord>::max();
+            auto const expected = std::vector<BlockIndex>{ {-1,0,0}, {0,-17,40}, {0,0,0}, {15,0,0}, {16,0,0} };
+            CHECK_THAT(blocksIn({ {-coordMax,-coordMax,-coordMax}, {coordMax,coordMax,coordMax} }), matchers::c2::UnorderedRangeEquals(expected));
+        }
+
+        SECTION("// constness") {
+            auto const& cChunks = chunks;
+            cChunks.forEachIn({ {0,0,0}, {0,0,0} }, [](auto& block) {
+                static_assert(std::is_const_v<std::remove_reference_t<decltype(block)>>);
+            });
+            chunks.forEachIn({ {0,0,0}, {0,0,0} }, [](auto& block) {
+                static_assert(!std::is_const_v<std::remove_reference_t<decltype(block)>>);
+            });
+        }
+    }
+}
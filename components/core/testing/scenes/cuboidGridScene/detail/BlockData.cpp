@@ -34,21 +34,24 @@ using BlockData = gustave::core::scenes::cuboidGridScene::detail::BlockData<libC
 
 using BlockConstructionInfo = BlockData::BlockConstructionInfo;
 using BlockIndex = BlockData::BlockIndex;
+using Direction = BlockData::Direction;
 using LinkIndex = BlockData::LinkIndex;
 using SceneData = BlockData::SceneData;
 using StructureIdGenerator = gustave::utils::IndexGenerator<BlockData::StructureIndex>;
 
 TEST_CASE("core::scenes::cuboidGridScene::detail::BlockData") {
     auto scene = SceneData{ vector3(1.f, 2.f, 3.f, u.length) };
-    auto b111 = BlockData{ BlockConstructionInfo{ {1,1,1}, concrete_20m, 5.f * u.mass, false }, scene };
+    auto b111 = BlockData{ BlockConstructionInfo{ {1,1,1}, concrete_20m, 5.f * u.mass, false, 4 }, scene };
     auto const& cb111 = b111;
 
     SECTION("// constructor && const getters") {
         CHECK(cb111.index() == BlockIndex{ 1,1,1 });
         CHECK(cb111.mass() == 5.f * u.mass);
         CHECK(cb111.isFoundation() == false);
+        CHECK(cb111.materialId() == 4);
         CHECK(cb111.isValid() == true);
         CHECK(&cb111.sceneData() == &scene);
+        CHECK(cb111.neighbourMask() == 0);
     }
 
     SECTION(".invalidate()") {
@@ -74,6 +77,17 @@ TEST_CASE("core::scenes::cuboidGridScene::detail::BlockData") {
         }
     }
 
+    SECTION(".setNeighbourAlong()") {
+        b111.setNeighbourAlong(Direction::plusY(), true);
+        b111.setNeighbourAlong(Direction::minusZ(), true);
+        CHECK(cb111.hasNeighbourAlong(Direction::plusY()));
+        CHECK(cb111.hasNeighbourAlong(Direction::minusZ()));
+        CHECK_FALSE(cb111.hasNeighbourAlong(Direction::plusX()));
+        b111.setNeighbourAlong(Direction::plusY(), false);
+        CHECK_FALSE(cb111.hasNeighbourAlong(Direction::plusY()));
+        CHECK(cb111.neighbourMask() == 0b100000);
+    }
+
     SECTION(".setSceneData()") {
         auto scene2 = SceneData{ vector3(2.f, 3.f, 4.f, u.length) };
         b111.setSceneData(scene2);
@@ -0,0 +1,49 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gustave/core/scenes/cuboidGridScene/detail/ChunkGrid.hpp>
+
+#include <TestHelpers.hpp>
+
+namespace cuboid = gustave::core::scenes::cuboidGridScene;
+
+using BlockIndex = cuboid::BlockIndex;
+using BlockRegion = cuboid::BlockRegion;
+using ChunkGrid = cuboid::detail::ChunkGrid;
+
+TEST_CASE("core::scenes::cuboidGridScene::detail::ChunkGrid") {
+    SECTION("::chunkIdOf()") {
+        CHECK(ChunkGrid::chunkIdOf({ 0,0,0 }) == BlockIndex{ 0,0,0 });
+        CHECK(ChunkGrid::chunkIdOf({ 15,16,-1 }) == BlockIndex{ 0,1,-1 });
+        CHECK(ChunkGrid::chunkIdOf({ -16,-17,31 }) == BlockIndex{ -1,-2,1 });
+    }
+
+    SECTION("::chunkRegionOf()") {
+        CHECK(ChunkGrid::chunkRegionOf({ 0,1,-1 }) == BlockRegion{ { 0,16,-16 }, { 15,31,-1 } });
+        for (BlockIndex const& index : { BlockIndex{ 0,0,0 }, BlockIndex{ 15,16,-1 }, BlockIndex{ -16,-17,31 } }) {
+            CHECK(ChunkGrid::chunkRegionOf(ChunkGrid::chunkIdOf(index)).contains(index));
+        }
+    }
+}
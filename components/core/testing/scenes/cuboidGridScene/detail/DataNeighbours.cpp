@@ -64,8 +64,10 @@ TEST_CASE("core::scenes::cuboidGridScene::detail::DataNeighbours") {
     auto& minusZ = addBlock({ min, 1, 1 });
     addBlock({ max, 1, 2 });
     addBlock({ min, 2, 3 });
+    source.setNeighbourAlong(Direction::plusX(), true);
+    source.setNeighbourAlong(Direction::minusZ(), true);
 
-    auto neighbours = DataNeighbours{ scene, source.index() };
+    auto neighbours = DataNeighbours{ scene, source };
 
     auto const expected = std::array{
         DataNeighbour{ Direction::plusX(), plusX },
@@ -0,0 +1,93 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <array>
+
+#include <gustave/core/scenes/cuboidGridScene/detail/GroundLinks.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/SceneData.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/SceneUpdater.hpp>
+
+#include <TestHelpers.hpp>
+
+namespace cuboid = ::gustave::core::scenes::cuboidGridScene;
+
+using GroundLinks = cuboid::detail::GroundLinks<libCfg,void>;
+using SceneData = cuboid::detail::SceneData<libCfg,void>;
+using SceneUpdater = cuboid::detail::SceneUpdater<libCfg,void>;
+
+using BlockIndex = SceneData::BlockIndex;
+using Direction = GroundLinks::Direction;
+using Transaction = SceneUpdater::Transaction;
+
+TEST_CASE("core::scenes::cuboidGridScene::detail::GroundLinks") {
+    auto const blockSize = vector3(1.f, 2.f, 3.f, u.length);
+    // Ground: y < 0, and the column {x=3,z=0} up to y < 2.
+    auto const terrain = SceneData::Terrain::heightField([](auto x, auto z) { return (x == 3 && z == 0) ? 2 : 0; }, concrete_20m);
+    auto scene = SceneData{ blockSize, terrain };
+    auto& blocks = scene.blocks;
+
+    Transaction t;
+    t.addBlock({ {2,0,0}, concrete_20m, 1000.f * u.mass, false });
+    t.addBlock({ {2,1,0}, concrete_20m, 1000.f * u.mass, false });
+    t.addBlock({ {1,0,0}, concrete_20m, 1000.f * u.mass, false });
+    t.addBlock({ {4,0,0}, concrete_20m, 1000.f * u.mass, true });
+    t.addBlock({ {2,5,0}, concrete_20m, 1000.f * u.mass, false });
+    SceneUpdater{ scene }.runTransaction(t);
+
+    SECTION(".begin() // & .end()") {
+        SECTION("// non-empty") {
+            auto const expected = std::array{ Direction::plusX(), Direction::minusY() };
+            CHECK_THAT(GroundLinks(scene, blocks.at({ 2,0,0 })), matchers::c2::RangeEquals(expected));
+        }
+
+        SECTION("// empty: foundation") {
+            auto const links = GroundLinks{ scene, blocks.at({ 4,0,0 }) };
+            CHECK(links.begin() == links.end());
+        }
+
+        SECTION("// empty: no terrain") {
+            auto noTerrainScene = SceneData{ blockSize };
+            t.clear();
+            t.addBlock({ {0,0,0}, concrete_20m, 1000.f * u.mass, false });
+            SceneUpdater{ noTerrainScene }.runTransaction(t);
+            auto const links = GroundLinks{ noTerrainScene, noTerrainScene.blocks.at({ 0,0,0 }) };
+            CHECK(links.begin() == links.end());
+        }
+    }
+
+    SECTION(".size()") {
+        SECTION("// 0") {
+            CHECK(GroundLinks(scene, blocks.at({ 2,5,0 })).size() == 0);
+        }
+
+        SECTION("// 1") {
+            CHECK(GroundLinks(scene, blocks.at({ 2,1,0 })).size() == 1);
+            CHECK(GroundLinks(scene, blocks.at({ 1,0,0 })).size() == 1);
+        }
+
+        SECTION("// 2") {
+            CHECK(GroundLinks(scene, blocks.at({ 2,0,0 })).size() == 2);
+        }
+    }
+}
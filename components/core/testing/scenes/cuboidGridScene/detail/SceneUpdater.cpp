@@ -29,7 +29,9 @@
 
 #include <gustave/core/scenes/cuboidGridScene/detail/SceneUpdater.hpp>
 #include <gustave/core/scenes/cuboidGridScene/detail/DataNeighbours.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/IndexNeighbours.hpp>
 
+#include <ReverseExecutor.hpp>
 #include <SceneUserData.hpp>
 #include <TestHelpers.hpp>
 
@@ -37,6 +39,7 @@ namespace cuboid = gustave::core::scenes::cuboidGridScene;
 
 using SceneUpdater = cuboid::detail::SceneUpdater<libCfg, SceneUserData>;
 using ConstDataNeighbours = cuboid::detail::DataNeighbours<libCfg, SceneUserData, false>;
+using IndexNeighbours = cuboid::detail::IndexNeighbours;
 
 using SceneData = SceneUpdater::SceneData;
 
@@ -46,8 +49,13 @@ using Direction = gustave::math3d::BasicDirection;
 using LinkIndices = BlockData::LinkIndices;
 using StructureData = SceneData::StructureData;
 using StructureIndex = SceneData::StructureIndex;
+using Terrain = SceneData::Terrain;
 using Transaction = SceneUpdater::Transaction;
 
+using BlockRegion = cuboid::BlockRegion;
+using MaterialChange = Transaction::MaterialChange;
+using RegionFill = Transaction::RegionFill;
+
 using SolverStructure = StructureData::SolverStructure;
 using SolverLink = SolverStructure::Link;
 
@@ -70,10 +78,10 @@ TEST_CASE("core::scenes::cuboidGridScene::detail::SceneUpdater") {
         return result;
     };
 
-    auto runTransaction = [&](Transaction const& transaction) {
+    auto runTransaction = [&](Transaction const& transaction, auto&... executor) {
         auto oldStructures = copyMap(data.structures);
         auto oldBlocks = copyMap(data.blocks);
-        auto const result = SceneUpdater{ data }.runTransaction(transaction);
+        auto const result = SceneUpdater{ data }.runTransaction(transaction, executor...);
         // Check structure diff of the result.
         for (auto const& deletedStructureId : result.deletedStructures()) {
             auto extractedStruct = oldStructures.extract(deletedStructureId);
@@ -81,6 +89,10 @@ TEST_CASE("core::scenes::cuboidGridScene::detail::SceneUpdater") {
             CHECK_FALSE(extractedStruct->isValid());
             REQUIRE_FALSE(data.structures.contains(deletedStructureId));
         }
+        for (auto const& modifiedStructureId : result.modifiedStructures()) {
+            REQUIRE(oldStructures.contains(modifiedStructureId));
+            REQUIRE(data.structures.contains(modifiedStructureId));
+        }
         for (auto const& newStructureId : result.newStructures()) {
             REQUIRE_FALSE(oldStructures.contains(newStructureId));
             auto newStructure = data.structures.atShared(newStructureId);
@@ -116,7 +128,7 @@ TEST_CASE("core::scenes::cuboidGridScene::detail::SceneUpdater") {
                 REQUIRE(blockStructId == data.structureIdGenerator.invalidIndex());
             } else {
                 auto const& blockStruct = data.structures.at(blockPtr->structureId());
-                for (auto const& neighbour : ConstDataNeighbours{ data, blockPtr->index() }) {
+                for (auto const& neighbour : ConstDataNeighbours{ data, *blockPtr }) {
                     REQUIRE(blockStruct.solverIndices().contains(neighbour.otherBlock().index()));
                 }
             }
@@ -143,6 +155,11 @@ TEST_CASE("core::scenes::cuboidGridScene::detail::SceneUpdater") {
             checkNeighbour(Direction::plusX(), &LinkIndices::plusX);
             checkNeighbour(Direction::plusY(), &LinkIndices::plusY);
             checkNeighbour(Direction::plusZ(), &LinkIndices::plusZ);
+            // neighbourMask
+            for (auto const& indexNeighbour : IndexNeighbours{ blockPtr->index() }) {
+                bool const hasNeighbour = data.blocks.contains(indexNeighbour.index);
+                CHECK(blockPtr->hasNeighbourAlong(indexNeighbour.direction) == hasNeighbour);
+            }
         }
         return result;
     };
@@ -398,6 +415,270 @@ TEST_CASE("core::scenes::cuboidGridScene::detail::SceneUpdater") {
             CHECK(&structureOfX1 == &structureOf({ 1,0,0 }));
         }
 
+        SECTION("// Transaction{5+} -> Transaction{material}: structure updated in place") {
+            Transaction t;
+            for (int i = 0; i < 5; ++i) {
+                t.addBlock({ {0,i,0}, concrete_20m, blockMass, i == 0 });
+            }
+            t.addBlock({ {1,0,0}, concrete_20m, blockMass, true, 1 });
+            t.addBlock({ {1,1,0}, concrete_20m, blockMass, false, 1 });
+            runTransaction(t);
+            StructureData const& structure = structureOf({ 0,1,0 });
+            auto const oldSolverStructure = structure.solverStructurePtr();
+
+            t.clear();
+            t.changeMaterial(MaterialChange{ 0, concrete_40m, 2.f * u.one });
+            auto const result = runTransaction(t);
+            CHECK(result.newStructures().size() == 0);
+            CHECK(result.deletedStructures().size() == 0);
+            REQUIRE(result.modifiedStructures().size() == 1);
+            CHECK(result.modifiedStructures()[0] == structure.index());
+
+            CHECK(&structure == &structureOf({ 0,1,0 }));
+            CHECK(structure.solverStructurePtr() != oldSolverStructure);
+            CHECK(data.blocks.at({ 0,2,0 }).maxPressureStress() == concrete_40m);
+            CHECK(data.blocks.at({ 1,1,0 }).mass() == blockMass);
+            CHECK(data.blocks.at({ 1,1,0 }).maxPressureStress() == concrete_20m);
+            for (int i = 0; i < 5; ++i) {
+                NodeIndex const nodeId = getSolverIndex(structure, { 0,i,0 });
+                CHECK(structure.solverStructure().nodes()[nodeId].mass() == 2.f * blockMass);
+                CHECK(oldSolverStructure->nodes()[nodeId].mass() == blockMass);
+            }
+            for (int i = 0; i < 4; ++i) {
+                NodeIndex const bottom = getSolverIndex(structure, { 0,i,0 });
+                NodeIndex const top = getSolverIndex(structure, { 0,i + 1,0 });
+                checkLink(structure, bottom, top, Direction::plusY(), concrete_40m);
+            }
+            NodeIndex const x1y1 = getSolverIndex(structure, { 1,1,0 });
+            CHECK(structure.solverStructure().nodes()[x1y1].mass() == blockMass);
+
+            SECTION("// materials sharing a stress stay distinct") {
+                t.clear();
+                t.changeMaterial(MaterialChange{ 1, concrete_40m, 3.f * u.one });
+                runTransaction(t);
+                CHECK(data.blocks.at({ 1,1,0 }).mass() == 3.f * blockMass);
+                CHECK(data.blocks.at({ 0,1,0 }).mass() == 2.f * blockMass);
+            }
+        }
+
+        SECTION("// Transaction{3+} -> Transaction{1+, material}: new structure reads the new material") {
+            Transaction t;
+            t.addBlock({ {0,0,0}, concrete_20m, blockMass, true });
+            t.addBlock({ {0,1,0}, concrete_20m, blockMass, false });
+            t.addBlock({ {2,1,0}, concrete_20m, blockMass, false });
+            auto const r1 = runTransaction(t);
+            REQUIRE(r1.newStructures().size() == 2);
+            auto const structIdOfX2 = structureOf({ 2,1,0 }).index();
+
+            t.clear();
+            t.addBlock({ {0,2,0}, concrete_20m, blockMass, false });
+            t.changeMaterial(MaterialChange{ 0, concrete_40m });
+            auto const r2 = runTransaction(t);
+            CHECK(r2.newStructures().size() == 1);
+            CHECK(r2.deletedStructures().size() == 1);
+            REQUIRE(r2.modifiedStructures().size() == 1);
+            CHECK(r2.modifiedStructures()[0] == structIdOfX2);
+
+            StructureData const& structure = structureOf({ 0,1,0 });
+            checkLink(structure, getSolverIndex(structure, { 0,0,0 }), getSolverIndex(structure, { 0,1,0 }), Direction::plusY(), concrete_40m);
+            checkLink(structure, getSolverIndex(structure, { 0,1,0 }), getSolverIndex(structure, { 0,2,0 }), Direction::plusY(), concrete_40m);
+        }
+
+        SECTION("// Transaction{2+} -> Transaction{1 modified}: unshared solver structure isn't copied") {
+            Transaction t;
+            t.addBlock({ {0,0,0}, concrete_20m, blockMass, true });
+            t.addBlock({ {0,1,0}, concrete_20m, blockMass, false });
+            runTransaction(t);
+            StructureData const& structure = structureOf({ 0,1,0 });
+            SolverStructure const* const oldSolverStructure = &structure.solverStructure();
+
+            t.clear();
+            t.modifyBlock({ {0,1,0}, concrete_20m, 2.f * blockMass });
+            runTransaction(t);
+            CHECK(&structure.solverStructure() == oldSolverStructure);
+            CHECK(structure.solverStructure().nodes()[getSolverIndex(structure, { 0,1,0 })].mass() == 2.f * blockMass);
+        }
+
+        SECTION("// Transaction{5+} -> Transaction{2 modified}: structure updated in place") {
+            Transaction t;
+            for (int i = 0; i < 5; ++i) {
+                t.addBlock({ {0,i,0}, concrete_20m, blockMass, i == 0 });
+            }
+            t.addBlock({ {2,1,0}, concrete_20m, blockMass, false });
+            runTransaction(t);
+            StructureData const& structure = structureOf({ 0,1,0 });
+            auto const oldSolverStructure = structure.solverStructurePtr();
+
+            t.clear();
+            t.modifyBlock({ {0,0,0}, concrete_40m, 3.f * blockMass });
+            t.modifyBlock({ {0,2,0}, concrete_40m, 2.f * blockMass });
+            auto const result = runTransaction(t);
+            CHECK(result.newStructures().size() == 0);
+            CHECK(result.deletedStructures().size() == 0);
+            REQUIRE(result.modifiedStructures().size() == 1);
+            CHECK(result.modifiedStructures()[0] == structure.index());
+
+            CHECK(&structure == &structureOf({ 0,1,0 }));
+            CHECK(data.blocks.at({ 0,2,0 }).mass() == 2.f * blockMass);
+            CHECK(data.blocks.at({ 0,2,0 }).maxPressureStress() == concrete_40m);
+            auto const& nodes = structure.solverStructure().nodes();
+            CHECK(nodes[getSolverIndex(structure, { 0,0,0 })].mass() == 3.f * blockMass);
+            CHECK(nodes[getSolverIndex(structure, { 0,1,0 })].mass() == blockMass);
+            CHECK(nodes[getSolverIndex(structure, { 0,2,0 })].mass() == 2.f * blockMass);
+            CHECK(oldSolverStructure->nodes()[getSolverIndex(structure, { 0,2,0 })].mass() == blockMass);
+            auto const linkY = [&](int y, PressureStress const& stress) {
+                checkLink(structure, getSolverIndex(structure, { 0,y,0 }), getSolverIndex(structure, { 0,y + 1,0 }), Direction::plusY(), stress);
+            };
+            linkY(0, concrete_20m);
+            linkY(1, concrete_20m);
+            linkY(2, concrete_20m);
+            linkY(3, concrete_20m);
+
+            t.clear();
+            t.modifyBlock({ {0,1,0}, concrete_40m, blockMass });
+            runTransaction(t);
+            linkY(0, concrete_40m);
+            linkY(1, concrete_40m);
+            linkY(2, concrete_20m);
+        }
+
+        SECTION("// Transaction{1+} -> Transaction{1-, 1 modified}: invalid modification") {
+            Transaction t;
+            t.addBlock({ {0,0,0}, concrete_20m, blockMass, true });
+            runTransaction(t);
+
+            SECTION("// missing block") {
+                t.clear();
+                t.modifyBlock({ {1,0,0}, concrete_40m, blockMass });
+                CHECK_THROWS_AS(runTransaction(t), std::invalid_argument);
+            }
+
+            SECTION("// deleted block") {
+                t.clear();
+                t.removeBlock({ 0,0,0 });
+                t.modifyBlock({ {0,0,0}, concrete_40m, blockMass });
+                CHECK_THROWS_AS(runTransaction(t), std::invalid_argument);
+            }
+        }
+
+        SECTION("// Transaction{2 fills}: pillar on a foundation slab") {
+            Transaction t;
+            t.fillRegion(RegionFill{ BlockRegion{ {0,0,0}, {2,0,2} }, concrete_20m, blockMass, true });
+            t.fillRegion(RegionFill{ BlockRegion{ {1,1,1}, {1,3,1} }, concrete_20m, blockMass, false });
+            auto const result = runTransaction(t);
+            CHECK(result.newStructures().size() == 1);
+            CHECK(result.deletedStructures().size() == 0);
+
+            CHECK(data.blocks.size() == 12);
+            StructureData const& structure = structureOf({ 1,3,1 });
+            CHECK(structure.solverIndices().size() == 4);
+            NodeIndex const y0 = getSolverIndex(structure, { 1,0,1 });
+            NodeIndex const y1 = getSolverIndex(structure, { 1,1,1 });
+            NodeIndex const y2 = getSolverIndex(structure, { 1,2,1 });
+            checkLink(structure, y0, y1, Direction::plusY(), concrete_20m);
+            checkLink(structure, y1, y2, Direction::plusY(), concrete_20m);
+        }
+
+        SECTION("// Transaction{fill}: occupancy array with 2 components") {
+            Transaction t;
+            t.fillRegion(RegionFill{ BlockRegion{ {0,0,0}, {2,1,0} }, { true, false, false, false, true, true }, concrete_20m, blockMass, false });
+            auto const result = runTransaction(t);
+            CHECK(result.newStructures().size() == 2);
+            CHECK(data.blocks.size() == 3);
+            CHECK(structureOf({ 0,0,0 }).index() != structureOf({ 1,1,0 }).index());
+            CHECK(structureOf({ 1,1,0 }).index() == structureOf({ 2,1,0 }).index());
+        }
+
+        SECTION("// Transaction{fill}: custom executor") {
+            Transaction t;
+            t.fillRegion(RegionFill{ BlockRegion{ {0,0,0}, {6,0,0} }, concrete_20m, blockMass, true });
+            t.fillRegion(RegionFill{ BlockRegion{ {0,1,0}, {6,2,0} }, { true, false, true, false, true, false, true, true, false, true, false, true, false, true }, concrete_20m, blockMass, false });
+            auto executor = ReverseExecutor{};
+            auto const result = runTransaction(t, executor);
+            CHECK(result.newStructures().size() == 4);
+            for (int x = 0; x < 7; x += 2) {
+                StructureData const& structure = structureOf({ x,1,0 });
+                CHECK(structure.solverIndices().size() == 3);
+                NodeIndex const y0 = getSolverIndex(structure, { x,0,0 });
+                NodeIndex const y1 = getSolverIndex(structure, { x,1,0 });
+                NodeIndex const y2 = getSolverIndex(structure, { x,2,0 });
+                checkLink(structure, y0, y1, Direction::plusY(), concrete_20m);
+                checkLink(structure, y1, y2, Direction::plusY(), concrete_20m);
+            }
+        }
+
+        SECTION("// Transaction{fill} -> Transaction{fill}: fill merges existing structures") {
+            Transaction t;
+            t.addBlock({ {0,0,0}, concrete_20m, blockMass, false });
+            t.addBlock({ {4,0,0}, concrete_20m, blockMass, false });
+            auto const r1 = runTransaction(t);
+            CHECK(r1.newStructures().size() == 2);
+
+            t.clear();
+            t.fillRegion(RegionFill{ BlockRegion{ {1,0,0}, {3,0,0} }, concrete_20m, blockMass, false });
+            auto const r2 = runTransaction(t);
+            CHECK(r2.newStructures().size() == 1);
+            CHECK(r2.deletedStructures().size() == 2);
+            CHECK(structureOf({ 0,0,0 }).solverIndices().size() == 5);
+        }
+
+        SECTION("// Transaction{2 fills} -> Transaction{clear}: split structure") {
+            Transaction t;
+            t.fillRegion(RegionFill{ BlockRegion{ {0,0,0}, {2,0,0} }, concrete_20m, blockMass, true });
+            t.fillRegion(RegionFill{ BlockRegion{ {0,1,0}, {2,1,0} }, concrete_20m, blockMass, false });
+            auto const r1 = runTransaction(t);
+            CHECK(r1.newStructures().size() == 1);
+
+            t.clear();
+            t.clearRegion(BlockRegion{ {1,0,0}, {1,5,0} });
+            auto const r2 = runTransaction(t);
+            CHECK(r2.newStructures().size() == 2);
+            CHECK(r2.deletedStructures().size() == 1);
+            CHECK(data.blocks.size() == 4);
+            CHECK_FALSE(data.blocks.contains({ 1,1,0 }));
+            CHECK(structureOf({ 0,1,0 }).solverIndices().size() == 2);
+        }
+
+        SECTION("// Transaction{fill} -> Transaction{clear+fill}: replaced region") {
+            Transaction t;
+            t.fillRegion(RegionFill{ BlockRegion{ {0,0,0}, {1,1,1} }, concrete_20m, blockMass, false });
+            runTransaction(t);
+
+            t.clear();
+            t.clearRegion(BlockRegion{ {0,0,0}, {1,1,1} });
+            t.fillRegion(RegionFill{ BlockRegion{ {0,0,0}, {1,1,1} }, concrete_40m, blockMass, false });
+            auto const r2 = runTransaction(t);
+            CHECK(r2.newStructures().size() == 1);
+            CHECK(r2.deletedStructures().size() == 1);
+            CHECK(data.blocks.at({ 1,1,1 }).maxPressureStress() == concrete_40m);
+        }
+
+        SECTION("// Transaction{fill}: invalid fills") {
+            Transaction t;
+            t.addBlock({ {1,0,0}, concrete_20m, blockMass, true });
+            runTransaction(t);
+
+            SECTION("// existing block") {
+                t.clear();
+                t.fillRegion(RegionFill{ BlockRegion{ {0,0,0}, {2,0,0} }, concrete_20m, blockMass, false });
+                CHECK_THROWS_AS(SceneUpdater{ data }.runTransaction(t), std::invalid_argument);
+            }
+
+            SECTION("// overlapping block of the transaction") {
+                t.clear();
+                t.addBlock({ {3,0,0}, concrete_20m, blockMass, true });
+                t.fillRegion(RegionFill{ BlockRegion{ {2,0,0}, {4,0,0} }, concrete_20m, blockMass, false });
+                CHECK_THROWS_AS(SceneUpdater{ data }.runTransaction(t), std::invalid_argument);
+            }
+
+            SECTION("// overlapping fills") {
+                t.clear();
+                t.fillRegion(RegionFill{ BlockRegion{ {2,0,0}, {4,0,0} }, concrete_20m, blockMass, false });
+                t.fillRegion(RegionFill{ BlockRegion{ {4,0,0}, {5,0,0} }, concrete_20m, blockMass, false });
+                CHECK_THROWS_AS(SceneUpdater{ data }.runTransaction(t), std::invalid_argument);
+            }
+        }
+
         SECTION("// Transaction{1+}: invalid addition") {
             Transaction t;
             t.addBlock({ {1,0,0}, concrete_20m, blockMass, true });
@@ -412,4 +693,71 @@ TEST_CASE("core::scenes::cuboidGridScene::detail::SceneUpdater") {
             CHECK_THROWS_AS(SceneUpdater{ data }.runTransaction(t), std::invalid_argument);
         }
     }
+
+    SECTION("// terrain") {
+        SceneData terrainData{ blockSize, Terrain::heightField([](auto, auto) { return 0; }, concrete_40m) };
+        auto runTerrainTransaction = [&](Transaction const& transaction) {
+            return SceneUpdater{ terrainData }.runTransaction(transaction);
+        };
+        auto structureAt = [&](BlockIndex const& index) -> StructureData const& {
+            return terrainData.structures.at(terrainData.blocks.at(index).structureId());
+        };
+        auto groundConductivity = [&](Direction direction, PressureStress const& maxStress) {
+            return (terrainData.contactAreaAlong(direction) / terrainData.thicknessAlong(direction)) * maxStress;
+        };
+
+        SECTION("// blocks on the ground share a single foundation node") {
+            Transaction t;
+            t.addBlock({ {0,0,0}, concrete_20m, blockMass, false });
+            t.addBlock({ {1,0,0}, concrete_20m, blockMass, false });
+            t.addBlock({ {1,1,0}, concrete_20m, blockMass, false });
+            auto const result = runTerrainTransaction(t);
+            REQUIRE(result.newStructures().size() == 1);
+
+            StructureData const& structure = structureAt({ 0,0,0 });
+            auto const& solverStructure = structure.solverStructure();
+            REQUIRE(structure.groundNodeIndex());
+            NodeIndex const groundId = *structure.groundNodeIndex();
+            CHECK(solverStructure.nodes().size() == 4);
+            CHECK(solverStructure.nodes()[groundId].isFoundation);
+            CHECK(solverStructure.nodes()[groundId].mass() == StructureData::groundNodeMass());
+            CHECK(solverStructure.links().size() == 4);
+            CHECK(structure.groundLinkIndices().size() == 2);
+            for (BlockIndex const index : { BlockIndex{ 0,0,0 }, BlockIndex{ 1,0,0 } }) {
+                auto const& link = solverStructure.links().at(structure.groundLinkIndices().at(index));
+                CHECK(link.localNodeId() == *structure.solverIndexOf(index));
+                CHECK(link.otherNodeId() == groundId);
+                CHECK(link.normal() == NormalizedVector3::basisVector(Direction::minusY()));
+                CHECK(link.conductivity() == groundConductivity(Direction::minusY(), concrete_20m));
+            }
+
+            SECTION("// material change updates the ground links") {
+                t.clear();
+                t.changeMaterial(MaterialChange{ 0, concrete_40m });
+                auto const r2 = runTerrainTransaction(t);
+                CHECK(r2.modifiedStructures().size() == 1);
+                auto const linkId = structure.groundLinkIndices().at({ 1,0,0 });
+                CHECK(structure.solverStructure().links().at(linkId).conductivity() == groundConductivity(Direction::minusY(), concrete_40m));
+            }
+        }
+
+        SECTION("// block above the ground") {
+            Transaction t;
+            t.addBlock({ {0,1,0}, concrete_20m, blockMass, false });
+            runTerrainTransaction(t);
+            StructureData const& structure = structureAt({ 0,1,0 });
+            CHECK_FALSE(structure.groundNodeIndex());
+            CHECK(structure.solverStructure().nodes().size() == 1);
+        }
+
+        SECTION("// invalid insertion inside the terrain") {
+            Transaction t;
+            t.addBlock({ {0,-1,0}, concrete_20m, blockMass, false });
+            CHECK_THROWS_AS(runTerrainTransaction(t), std::invalid_argument);
+
+            t.clear();
+            t.fillRegion(RegionFill{ BlockRegion{ {0,-1,0}, {0,0,0} }, concrete_20m, blockMass, false });
+            CHECK_THROWS_AS(runTerrainTransaction(t), std::invalid_argument);
+        }
+    }
 }
@@ -0,0 +1,137 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <array>
+
+#include <gustave/core/scenes/cuboidGridScene/structureReference/LinkViews.hpp>
+#include <gustave/core/scenes/cuboidGridScene/structureReference/Links.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/SceneData.hpp>
+#include <gustave/core/scenes/cuboidGridScene/detail/SceneUpdater.hpp>
+
+#include <TestHelpers.hpp>
+#include <SceneUserData.hpp>
+
+namespace cuboid = gustave::core::scenes::cuboidGridScene;
+
+using SceneData = cuboid::detail::SceneData<libCfg, SceneUserData>;
+using SceneUpdater = cuboid::detail::SceneUpdater<libCfg, SceneUserData>;
+
+using LinkViews = cuboid::structureReference::LinkViews<libCfg, SceneUserData>;
+using Links = cuboid::structureReference::Links<libCfg, SceneUserData, false>;
+
+using BlockIndex = SceneData::BlockIndex;
+using ContactIndex = LinkViews::ContactView::ContactIndex;
+using Direction = ContactIndex::Direction;
+using StructureData = SceneData::StructureData;
+using Transaction = SceneUpdater::Transaction;
+
+TEST_CASE("core::scenes::cuboidGridScene::structureReference::LinkViews") {
+    auto const blockSize = vector3(1.f, 1.f, 1.f, u.length);
+    auto scene = SceneData{ blockSize };
+
+    Transaction t;
+    t.addBlock({ {2,3,3}, concrete_20m, 2000.f * u.mass, true });
+    t.addBlock({ {3,2,3}, concrete_20m, 2000.f * u.mass, true });
+    t.addBlock({ {3,3,2}, concrete_20m, 2000.f * u.mass, true });
+    t.addBlock({ {3,3,3}, concrete_20m, 2000.f * u.mass, false });
+    t.addBlock({ {3,3,4}, concrete_20m, 2000.f * u.mass, false });
+    t.addBlock({ {3,3,5}, concrete_20m, 2000.f * u.mass, true });
+    t.addBlock({ {3,3,6}, concrete_20m, 2000.f * u.mass, false });
+    t.addBlock({ {3,4,3}, concrete_20m, 2000.f * u.mass, false });
+    t.addBlock({ {3,5,3}, concrete_20m, 2000.f * u.mass, true });
+    t.addBlock({ {4,3,3}, concrete_20m, 2000.f * u.mass, false });
+    SceneUpdater{ scene }.runTransaction(t);
+
+    auto const& structure333 = scene.structures.at(scene.blocks.at({ 3,3,3 }).structureId());
+    auto const linkViews = LinkViews{ structure333 };
+
+    SECTION(".begin() // && .end()") {
+        auto const expectedIds = std::array{
+            ContactIndex{ {2,3,3}, Direction::plusX() },
+            ContactIndex{ {3,2,3}, Direction::plusY() },
+            ContactIndex{ {3,3,2}, Direction::plusZ() },
+            ContactIndex{ {3,3,3}, Direction::plusX() },
+            ContactIndex{ {3,3,3}, Direction::plusY() },
+            ContactIndex{ {3,3,3}, Direction::plusZ() },
+            ContactIndex{ {3,3,4}, Direction::plusZ() },
+            ContactIndex{ {3,4,3}, Direction::plusY() },
+        };
+        auto ids = linkViews | std::views::transform([](auto&& view) { return view.index(); });
+        CHECK_THAT(ids, matchers::c2::UnorderedRangeEquals(expectedIds));
+    }
+
+    SECTION("// matches Links") {
+        auto links = Links{ structure333 };
+        auto linkIt = links.begin();
+        for (auto const& view : linkViews) {
+            REQUIRE(linkIt != links.end());
+            auto const& contact = *linkIt;
+            CHECK(view.index() == contact.index());
+            CHECK(view.area() == contact.area());
+            CHECK(view.localBlock().index() == contact.localBlock().index());
+            CHECK(view.maxPressureStress() == contact.maxPressureStress());
+            CHECK(view.otherBlock().index() == contact.otherBlock().index());
+            CHECK(view.solverIndex() == contact.solverIndex());
+            CHECK(view.structureIndex() == contact.structure().index());
+            ++linkIt;
+        }
+        CHECK(linkIt == links.end());
+    }
+
+    SECTION("// ground contacts") {
+        auto terrainScene = SceneData{ blockSize, SceneData::Terrain::heightField([](auto, auto) { return 0; }, concrete_20m) };
+        t.clear();
+        t.addBlock({ {0,0,0}, concrete_20m, 2000.f * u.mass, false });
+        t.addBlock({ {0,1,0}, concrete_20m, 2000.f * u.mass, false });
+        t.addBlock({ {1,0,0}, concrete_20m, 2000.f * u.mass, false });
+        t.addBlock({ {2,0,0}, concrete_20m, 2000.f * u.mass, true });
+        SceneUpdater{ terrainScene }.runTransaction(t);
+
+        auto const& structure000 = terrainScene.structures.at(terrainScene.blocks.at({ 0,0,0 }).structureId());
+        auto const groundViews = LinkViews{ structure000 };
+        auto const expectedIds = std::array{
+            ContactIndex{ {0,0,0}, Direction::plusX() },
+            ContactIndex{ {0,0,0}, Direction::plusY() },
+            ContactIndex{ {0,0,0}, Direction::minusY() },
+            ContactIndex{ {1,0,0}, Direction::plusX() },
+            ContactIndex{ {1,0,0}, Direction::minusY() },
+        };
+        auto ids = groundViews | std::views::transform([](auto&& view) { return view.index(); });
+        CHECK_THAT(ids, matchers::c2::UnorderedRangeEquals(expectedIds));
+
+        auto links = Links{ structure000 };
+        auto linkIt = links.begin();
+        for (auto const& view : groundViews) {
+            REQUIRE(linkIt != links.end());
+            auto const& contact = *linkIt;
+            CHECK(view.index() == contact.index());
+            CHECK(view.isGroundContact() == contact.isGroundContact());
+            CHECK(view.isGroundContact() == (view.index().direction() == Direction::minusY()));
+            CHECK(view.solverIndex() == contact.solverIndex());
+            ++linkIt;
+        }
+        CHECK(linkIt == links.end());
+    }
+}
@@ -23,22 +23,29 @@
  * SOFTWARE.
  */
 
+#include <cstddef>
 #include <memory>
+#include <stdexcept>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 #include <gustave/core/solvers/Force1Solver.hpp>
 
+#include <ReverseExecutor.hpp>
 #include <TestHelpers.hpp>
 
 using Solver = gustave::core::solvers::Force1Solver<libCfg>;
 
+using ForceStress = Solver::ForceStress;
 using Link = Solver::Structure::Link;
+using LoadCase = Solver::LoadCase;
 using Node = Solver::Structure::Node;
 using NodeIndex = Solver::Structure::NodeIndex;
 using Solution = Solver::Solution;
 using Structure = Solver::Structure;
+using Verdict = Solver::LinkStability::Verdict;
 
 TEST_CASE("core::force1::Solver") {
     constexpr float precision = 0.001f;
@@ -58,11 +65,273 @@ TEST_CASE("core::force1::Solver") {
         };
         constexpr unsigned blockCount = 10;
         auto structure = std::make_shared<Structure const>(makePillar(blockCount));
+        auto checkSolution = [&](Solver::Result const& result) {
+            auto const solvedNodes = result.solution().nodes();
+            CHECK_THAT(solvedNodes.at(0).forceVectorFrom(1), matchers::WithinRel(float(blockCount - 1) * blockMass * g, precision));
+            CHECK_THAT(solvedNodes.at(1).forceVectorFrom(2), matchers::WithinRel(float(blockCount - 2) * blockMass * g, precision));
+            CHECK_THAT(solvedNodes.at(2).forceVectorFrom(3), matchers::WithinRel(float(blockCount - 3) * blockMass * g, precision));
+        };
+
+        SECTION("// default executor") {
+            checkSolution(solver.run(structure));
+        }
+
+        SECTION("// custom executor") {
+            auto executor = ReverseExecutor{};
+            checkSolution(solver.run(structure, executor));
+        }
+
+        SECTION("// custom executor: many pillars") {
+            constexpr unsigned pillarCount = 200;
+            auto rowStructure = std::make_shared<Structure>();
+            for (unsigned pillarId = 0; pillarId < pillarCount; ++pillarId) {
+                auto const base = static_cast<NodeIndex>(rowStructure->nodes().size());
+                for (unsigned i = 0; i < 4; ++i) {
+                    rowStructure->addNode(Node{ blockMass, i == 0 });
+                }
+                for (unsigned i = 0; i < 3; ++i) {
+                    rowStructure->addLink(Link{ base + i, base + i + 1, Normals::y, 1.f * u.area, 1.f * u.length, concrete_20m });
+                }
+            }
+            auto executor = ReverseExecutor{};
+            auto const result = solver.run(rowStructure, executor);
+            auto const solvedNodes = result.solution().nodes();
+            CHECK_THAT(solvedNodes.at(0).forceVectorFrom(1), matchers::WithinRel(3.f * blockMass * g, precision));
+            CHECK_THAT(solvedNodes.at(797).forceVectorFrom(798), matchers::WithinRel(2.f * blockMass * g, precision));
+        }
+
+        SECTION("// mixed precision") {
+            auto config = Solver::Config{ g, precision };
+            config.setMixedPrecision(true);
+            auto const mixedSolver = Solver{ config };
+            checkSolution(mixedSolver.run(structure));
+        }
+
+        SECTION("// domain decomposition") {
+            auto config = Solver::Config{ g, precision };
+            config.setSubdomainSize(3);
+            auto const ddSolver = Solver{ config };
+            auto executor = ReverseExecutor{};
+            checkSolution(ddSolver.run(structure, executor));
+        }
+
+        SECTION("// compact solutions") {
+            auto config = Solver::Config{ g, precision };
+            config.setCompactSolutions(true);
+            auto const compactSolver = Solver{ config };
+            auto const compactResult = compactSolver.run(structure);
+            checkSolution(compactResult);
+            CHECK(compactResult.solution().isCompact());
+            CHECK(compactResult.solution().memoryUsage() < solver.run(structure).solution().memoryUsage());
+        }
+
+        SECTION("// warm start") {
+            auto const coldResult = solver.run(structure);
+            REQUIRE(coldResult.isSolved());
+
+            SECTION("// same structure") {
+                auto const warmResult = solver.run(structure, coldResult.solution());
+                checkSolution(warmResult);
+                CHECK(warmResult.iterations() <= coldResult.iterations());
+            }
+
+            SECTION("// same structure: wall") {
+                // Hyperstatic: the first solve needs many iterations.
+                constexpr unsigned width = 12;
+                auto wall = std::make_shared<Structure>();
+                for (unsigned y = 0; y < width; ++y) {
+                    for (unsigned x = 0; x < width; ++x) {
+                        wall->addNode(Node{ blockMass, y == 0 && (x == 0 || x == width - 1) });
+                    }
+                }
+                for (unsigned y = 0; y < width; ++y) {
+                    for (unsigned x = 0; x < width; ++x) {
+                        unsigned const id = y * width + x;
+                        if (x + 1 < width) {
+                            wall->addLink(Link{ id, id + 1, Normals::x, 1.f * u.area, 1.f * u.length, concrete_20m });
+                        }
+                        if (y + 1 < width) {
+                            wall->addLink(Link{ id, id + width, Normals::y, 1.f * u.area, 1.f * u.length, concrete_20m });
+                        }
+                    }
+                }
+                auto const coldWall = solver.run(wall);
+                REQUIRE(coldWall.isSolved());
+                auto const warmWall = solver.run(wall, coldWall.solution());
+                REQUIRE(warmWall.isSolved());
+                CHECK(warmWall.iterations() < coldWall.iterations());
+            }
+
+            SECTION("// same structure: basis only") {
+                auto executor = ReverseExecutor{};
+                auto const warmResult = solver.run(structure, coldResult.solution().basis(), executor);
+                checkSolution(warmResult);
+                CHECK(warmResult.iterations() <= coldResult.iterations());
+            }
+
+            SECTION("// modified conductivities") {
+                auto modified = std::make_shared<Structure>(*structure);
+                auto const newConductivity = (2.f * u.one) * structure->links()[0].conductivity();
+                modified->setLinkConductivity(0, newConductivity);
+                CHECK(modified->links()[0].conductivity() == newConductivity);
+                CHECK(structure->links()[0].conductivity() != newConductivity);
+                auto executor = ReverseExecutor{};
+                checkSolution(solver.run(modified, coldResult.solution(), executor));
+            }
+
+            SECTION("// modified masses & conductivities: reused decomposition") {
+                REQUIRE(coldResult.decompositionPtr() != nullptr);
+                auto modified = std::make_shared<Structure>(*structure);
+                modified->setLinkConductivity(1, (2.f * u.one) * structure->links()[1].conductivity());
+                modified->setNodeMass(blockCount - 1, 3.f * blockMass);
+                auto executor = ReverseExecutor{};
+                auto const warmResult = solver.run(modified, coldResult.solution().basis(), *coldResult.decompositionPtr(), executor);
+                auto const solvedNodes = warmResult.solution().nodes();
+                CHECK_THAT(solvedNodes.at(0).forceVectorFrom(1), matchers::WithinRel(float(blockCount + 1) * blockMass * g, precision));
+                CHECK_THAT(solvedNodes.at(8).forceVectorFrom(9), matchers::WithinRel(3.f * blockMass * g, precision));
+                CHECK(warmResult.decompositionPtr() != nullptr);
+            }
+
+            SECTION("// reused decomposition: subdomains") {
+                auto config = Solver::Config{ g, precision };
+                config.setSubdomainSize(3);
+                auto const ddSolver = Solver{ config };
+                auto const ddCold = ddSolver.run(structure);
+                REQUIRE(ddCold.decompositionPtr() != nullptr);
+                auto const& subdomains = ddCold.decompositionPtr()->subdomains();
+                REQUIRE(subdomains != nullptr);
+                auto const ddWarm = ddSolver.run(structure, ddCold.solution().basis(), *ddCold.decompositionPtr());
+                checkSolution(ddWarm);
+                CHECK(ddWarm.decompositionPtr()->subdomains() == subdomains);
+            }
+
+            SECTION("// invalid node count") {
+                auto const smallStructure = std::make_shared<Structure const>(makePillar(blockCount - 1));
+                CHECK_THROWS_AS(solver.run(smallStructure, coldResult.solution()), std::invalid_argument);
+            }
+
+            SECTION("// invalid decomposition") {
+                auto const otherStructure = std::make_shared<Structure>(makePillar(blockCount));
+                otherStructure->addLink(Link{ 0, 2, Normals::y, 1.f * u.area, 1.f * u.length, concrete_20m });
+                auto const& basis = coldResult.solution().basis();
+                CHECK_THROWS_AS(solver.run(otherStructure, basis, *coldResult.decompositionPtr()), std::invalid_argument);
+            }
+        }
+
+        SECTION(".checkStability()") {
+            auto const weakForce = 100'000.f * u.force;
+            auto const strongForce = 100'000'000.f * u.force;
+
+            SECTION("// stable") {
+                auto const maxForces = std::vector<ForceStress>(blockCount - 1, ForceStress{ strongForce, strongForce, strongForce });
+                auto const result = solver.checkStability(*structure, maxForces);
+                CHECK(result.isDecided());
+                CHECK(result.isStable());
+                CHECK(result.links().size() == blockCount - 1);
+            }
+
+            SECTION("// unstable") {
+                auto const maxForces = std::vector<ForceStress>(blockCount - 1, ForceStress{ weakForce, weakForce, weakForce });
+                auto const result = solver.checkStability(*structure, maxForces);
+                auto const& links = result.links();
+                CHECK(result.isDecided());
+                CHECK_FALSE(result.isStable());
+                CHECK(links[0].verdict() == Verdict::Unstable);
+                CHECK(links[6].verdict() == Verdict::Unstable);
+                CHECK(links[7].verdict() == Verdict::Stable);
+                CHECK(links[8].verdict() == Verdict::Stable);
+                CHECK_THAT(links[0].stressRatio().compression(), matchers::WithinRel(3.6f * u.one, 0.05f));
+            }
+
+            SECTION("// invalid max force count") {
+                auto const maxForces = std::vector<ForceStress>(2, ForceStress{ strongForce, strongForce, strongForce });
+                CHECK_THROWS_AS(solver.checkStability(*structure, maxForces), std::invalid_argument);
+            }
+        }
+
+        SECTION(".runBatch()") {
+            SECTION("// valid") {
+                auto extraMasses = std::vector<Real<u.mass>>(blockCount, 0.f * u.mass);
+                extraMasses[blockCount - 1] = blockMass;
+                auto const loadCases = std::vector<LoadCase>{
+                    LoadCase{ g },
+                    LoadCase{ 2.f * g },
+                    LoadCase{ g, extraMasses },
+                    LoadCase{ -g },
+                };
+                auto const results = solver.runBatch(structure, loadCases);
+                REQUIRE(results.size() == 4);
+                checkSolution(results[0]);
+                auto const& nodes1 = results[1].solution().nodes();
+                CHECK_THAT(nodes1.at(0).forceVectorFrom(1), matchers::WithinRel(float(blockCount - 1) * blockMass * (2.f * g), precision));
+                CHECK_THAT(nodes1.at(2).forceVectorFrom(3), matchers::WithinRel(float(blockCount - 3) * blockMass * (2.f * g), precision));
+                auto const& nodes2 = results[2].solution().nodes();
+                CHECK_THAT(nodes2.at(0).forceVectorFrom(1), matchers::WithinRel(float(blockCount) * blockMass * g, precision));
+                CHECK_THAT(nodes2.at(2).forceVectorFrom(3), matchers::WithinRel(float(blockCount - 2) * blockMass * g, precision));
+                auto const& nodes3 = results[3].solution().nodes();
+                CHECK_THAT(nodes3.at(0).forceVectorFrom(1), matchers::WithinRel(float(blockCount - 1) * blockMass * (-g), precision));
+            }
+
+            SECTION("// extra masses: overlay of the shared structure") {
+                auto extraMasses = std::vector<Real<u.mass>>(blockCount, 0.f * u.mass);
+                extraMasses[blockCount - 1] = blockMass;
+                auto const loadCases = std::vector<LoadCase>{ LoadCase{ g, extraMasses } };
+                auto const results = solver.runBatch(structure, loadCases);
+                REQUIRE(results.size() == 1);
+                auto const& solution = results[0].solution();
+                CHECK(&solution.basis().structure() == structure.get());
+                CHECK(solution.nodes().at(blockCount - 1).mass() == 2.f * blockMass);
+                CHECK(solution.nodes().at(blockCount - 2).mass() == blockMass);
+                CHECK(solution.maxRelativeError() <= precision);
+            }
+
+            SECTION("// custom executor") {
+                auto const loadCases = std::vector<LoadCase>{
+                    LoadCase{ g },
+                    LoadCase{ -g },
+                };
+                auto executor = ReverseExecutor{};
+                auto const results = solver.runBatch(structure, loadCases, executor);
+                REQUIRE(results.size() == 2);
+                checkSolution(results[0]);
+                auto const& nodes1 = results[1].solution().nodes();
+                CHECK_THAT(nodes1.at(0).forceVectorFrom(1), matchers::WithinRel(float(blockCount - 1) * blockMass * (-g), precision));
+            }
+
+            SECTION("// invalid extra mass count") {
+                auto const loadCases = std::vector<LoadCase>{
+                    LoadCase{ g, std::vector<Real<u.mass>>(2, blockMass) },
+                };
+                CHECK_THROWS_AS(solver.runBatch(structure, loadCases), std::invalid_argument);
+            }
+        }
+    }
+
+    SECTION("// solvable: several foundations") {
+        // Foundations are merged into a single F1Node: the solution must still tell them apart.
+        constexpr Real<u.mass> blockMass = 4000.f * u.mass;
+        auto structure = std::make_shared<Structure>();
+        NodeIndex const found1 = structure->addNode(Node{ 1000.f * u.mass, true });
+        NodeIndex const found2 = structure->addNode(Node{ 3000.f * u.mass, true });
+        NodeIndex const leg1 = structure->addNode(Node{ blockMass, false });
+        NodeIndex const leg2 = structure->addNode(Node{ blockMass, false });
+
+        structure->addLink(Link{ found1, leg1, Normals::y, 1.f * u.area, 1.f * u.length, concrete_20m });
+        structure->addLink(Link{ found2, leg2, Normals::y, 1.f * u.area, 1.f * u.length, concrete_20m });
+        structure->addLink(Link{ leg1, leg2, Normals::x, 1.f * u.area, 1.f * u.length, concrete_20m });
+        structure->addLink(Link{ found1, found2, Normals::x, 1.f * u.area, 1.f * u.length, concrete_20m });
         auto const result = solver.run(structure);
-        auto const solvedNodes = result.solution().nodes();
-        CHECK_THAT(solvedNodes.at(0).forceVectorFrom(1), matchers::WithinRel(float(blockCount - 1) * blockMass * g, precision));
-        CHECK_THAT(solvedNodes.at(1).forceVectorFrom(2), matchers::WithinRel(float(blockCount - 2) * blockMass * g, precision));
-        CHECK_THAT(solvedNodes.at(2).forceVectorFrom(3), matchers::WithinRel(float(blockCount - 3) * blockMass * g, precision));
+        REQUIRE(result.isSolved());
+
+        auto const nodes = result.solution().nodes();
+        CHECK_THAT(nodes.at(found1).forceVectorFrom(leg1), matchers::WithinRel(blockMass * g, precision));
+        CHECK_THAT(nodes.at(found2).forceVectorFrom(leg2), matchers::WithinRel(blockMass * g, precision));
+        CHECK_THAT(nodes.at(found1).forceVectorFrom(leg2), matchers::WithinRel(Vector3<u.force>::zero(), precision));
+        CHECK_THAT(nodes.at(found1).weightVector(), matchers::WithinRel(1000.f * u.mass * g, precision));
+        CHECK_THAT(nodes.at(found2).weightVector(), matchers::WithinRel(3000.f * u.mass * g, precision));
+        CHECK(nodes.at(found1).contacts().size() == 2);
+        CHECK(nodes.at(found2).contacts().size() == 2);
+        CHECK(result.solution().basis().potentials().size() == 4);
     }
 
     SECTION("// unsolvable: unreachable non-foundation") {
@@ -76,5 +345,6 @@ TEST_CASE("core::force1::Solver") {
         structure->addLink(Link{ node3, node4, Normals::y, 1.f * u.area, 1.f * u.length, concrete_20m });
         auto const result = solver.run(structure);
         CHECK_FALSE(result.isSolved());
+        CHECK(result.decompositionPtr() == nullptr);
     }
 }
@@ -36,6 +36,24 @@ TEST_CASE("core::force1Solver::Config") {
         CHECK(config.g() == g);
         CHECK(config.targetMaxError() == 0.01f);
         CHECK(config.maxIterations() == 1000);
+        CHECK_FALSE(config.mixedPrecision());
+        CHECK(config.subdomainSize() == 0);
+        CHECK_FALSE(config.compactSolutions());
+    }
+
+    SECTION(".setCompactSolutions()") {
+        config.setCompactSolutions(true);
+        CHECK(config.compactSolutions());
+    }
+
+    SECTION(".setMixedPrecision()") {
+        config.setMixedPrecision(true);
+        CHECK(config.mixedPrecision());
+    }
+
+    SECTION(".setSubdomainSize()") {
+        config.setSubdomainSize(64);
+        CHECK(config.subdomainSize() == 64);
     }
 
     SECTION(".setMaxIterations()") {
@@ -0,0 +1,67 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <gustave/core/solvers/force1Solver/LinkStability.hpp>
+
+#include <TestHelpers.hpp>
+
+using LinkStability = gustave::core::solvers::force1Solver::LinkStability<libCfg>;
+
+using StressRatio = LinkStability::StressRatio;
+using Verdict = LinkStability::Verdict;
+
+TEST_CASE("core::force1Solver::LinkStability") {
+    auto const smallBound = StressRatio{ 0.05f, 0.05f, 0.05f };
+
+    SECTION(".verdict()") {
+        SECTION("// stable") {
+            auto const stability = LinkStability{ StressRatio{ 0.9f, 0.5f, 0.f }, smallBound };
+            CHECK(stability.verdict() == Verdict::Stable);
+        }
+
+        SECTION("// unstable") {
+            auto const stability = LinkStability{ StressRatio{ 0.f, 0.5f, 1.1f }, smallBound };
+            CHECK(stability.verdict() == Verdict::Unstable);
+        }
+
+        SECTION("// undecided") {
+            auto const stability = LinkStability{ StressRatio{ 0.98f, 0.5f, 0.f }, smallBound };
+            CHECK(stability.verdict() == Verdict::Undecided);
+        }
+    }
+
+    SECTION(".errorBound()") {
+        auto const stability = LinkStability{ StressRatio{ 0.9f, 0.5f, 0.f }, smallBound };
+        CHECK(stability.errorBound() == smallBound);
+    }
+
+    SECTION(".stressRatio()") {
+        auto const ratio = StressRatio{ 0.9f, 0.5f, 0.f };
+        auto const stability = LinkStability{ ratio, smallBound };
+        CHECK(stability.stressRatio() == ratio);
+    }
+}
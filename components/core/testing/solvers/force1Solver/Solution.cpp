@@ -25,6 +25,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
@@ -73,6 +74,14 @@ TEST_CASE("core::force1::Solution") {
     auto const force5 = yForce(-175'000.f);
     auto const force6 = yForce(-252'000.f);
 
+    SECTION(".basisPtr()") {
+        CHECK(solution.basisPtr() == basis);
+    }
+
+    SECTION(".memoryUsage()") {
+        CHECK(solution.memoryUsage() > sizeof(Solution));
+    }
+
     SECTION(".nodes()") {
         auto const nodes = solution.nodes();
 
@@ -172,4 +181,53 @@ TEST_CASE("core::force1::Solution") {
     SECTION(".maxRelativeError()") {
         CHECK_THAT(solution.maxRelativeError(), matchers::WithinRel(11.8f * u.one, epsilon));
     }
+
+    SECTION("// compact") {
+        auto compactConfig = std::make_shared<Config>(g, precision);
+        compactConfig->setCompactSolutions(true);
+        std::vector<Real<u.potential>> const potentialsCopy{ potentials.begin(), potentials.end() };
+        auto const compactBasis = std::make_shared<Solution::Basis const>(structure, compactConfig, potentialsCopy);
+        Solution const compact{ compactBasis };
+        REQUIRE(compact.isCompact());
+        CHECK_FALSE(solution.isCompact());
+
+        SECTION(".nodes()") {
+            auto const nodes = solution.nodes();
+            auto const compactNodes = compact.nodes();
+            for (NodeIndex id = 0; id < nodes.size(); ++id) {
+                auto const node = nodes.at(id);
+                auto const compactNode = compactNodes.at(id);
+                CHECK_THAT(compactNode.forceVectorFrom(0), matchers::WithinRel(node.forceVectorFrom(0), epsilon));
+                CHECK_THAT(compactNode.netForceVector(), matchers::WithinRel(node.netForceVector(), epsilon));
+                CHECK_THAT(compactNode.relativeError(), matchers::WithinRel(node.relativeError(), epsilon));
+                auto const compactContacts = compactNode.contacts();
+                CHECK(compactContacts.size() == node.contacts().size());
+                auto compactContactIt = compactContacts.begin();
+                for (auto const& contact : node.contacts()) {
+                    CHECK((*compactContactIt).index() == contact.index());
+                    ++compactContactIt;
+                }
+            }
+        }
+
+        SECTION(".contacts().forceVector()") {
+            auto const contacts = compact.contacts();
+            auto runTest = [&contacts](LinkIndex const linkIndex, Vector3<u.force> const& expected) {
+                ContactIndex localContactId{ linkIndex, true };
+                CHECK_THAT(contacts.at(localContactId).forceVector(), matchers::WithinRel(expected, epsilon));
+                CHECK_THAT(contacts.at(localContactId.opposite()).forceVector(), matchers::WithinRel(-expected, epsilon));
+            };
+            runTest(0, -force1);
+            runTest(3, -force4);
+            runTest(5, -force6);
+        }
+
+        SECTION(".maxRelativeError()") {
+            CHECK_THAT(compact.maxRelativeError(), matchers::WithinRel(11.8f * u.one, epsilon));
+        }
+
+        SECTION(".memoryUsage()") {
+            CHECK(compact.memoryUsage() < solution.memoryUsage());
+        }
+    }
 }
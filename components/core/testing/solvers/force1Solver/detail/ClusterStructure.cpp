@@ -122,6 +122,10 @@ TEST_CASE("core::force1Solver::detail::ClusterStructure") {
         auto const fStructure = F1Structure{ structure, config };
         auto const cStructure = ClusterStructure{ fStructure };
 
+        auto fId = [&](NodeIndex nodeId) -> NodeIndex {
+            return fStructure.fNodeIdOf(nodeId);
+        };
+
         SECTION(".clusters()") {
             std::vector<Cluster> const expected = {
                 Cluster{ {0,5}, 5.f * blockWeight },
@@ -134,9 +138,9 @@ TEST_CASE("core::force1Solver::detail::ClusterStructure") {
         SECTION(".clusterOfNode()") {
             static constexpr auto inv = ClusterStructure::invalidClusterId();
             std::vector<ClusterIndex> const expected = {
-                inv, inv, inv, inv, // y == 0
+                inv, inv,           // y == 0
                 0, 0, 0, 1, 1,      // y == 1
-                inv, inv, inv,      // x == 8
+                inv, inv,           // x == 8
                 0, 1, 1, 2, 2,      // y == 2
                 0, 2, 2,            // y == 3
             };
@@ -155,19 +159,19 @@ TEST_CASE("core::force1Solver::detail::ClusterStructure") {
             };
 
             std::vector<ClusterContact> const expected = {
-                lowerContact(x2y1, x2y0),
-                sideContact(x3y1, x4y1),
-                upperContact(x3y1, x3y2),
-                lowerContact(x3y1, x3y0),
-                sideContact(x2y2, x3y2),
-                sideContact(x4y1, x3y1),
-                upperContact(x5y1, x5y2),
-                lowerContact(x5y1, x5y0),
-                sideContact(x4y2, x5y2),
-                sideContact(x3y2, x2y2),
-                lowerContact(x3y2, x3y1),
-                sideContact(x5y2, x4y2),
-                lowerContact(x5y2, x5y1),
+                lowerContact(fId(x2y1), fId(x2y0)),
+                sideContact(fId(x3y1), fId(x4y1)),
+                upperContact(fId(x3y1), fId(x3y2)),
+                lowerContact(fId(x3y1), fId(x3y0)),
+                sideContact(fId(x2y2), fId(x3y2)),
+                sideContact(fId(x4y1), fId(x3y1)),
+                upperContact(fId(x5y1), fId(x5y2)),
+                lowerContact(fId(x5y1), fId(x5y0)),
+                sideContact(fId(x4y2), fId(x5y2)),
+                sideContact(fId(x3y2), fId(x2y2)),
+                lowerContact(fId(x3y2), fId(x3y1)),
+                sideContact(fId(x5y2), fId(x4y2)),
+                lowerContact(fId(x5y2), fId(x5y1)),
             };
             CHECK_THAT(cStructure.contacts(), matchers::c2::RangeEquals(expected));
         }
@@ -247,6 +251,10 @@ TEST_CASE("core::force1Solver::detail::ClusterStructure") {
         auto const fStructure = F1Structure{ structure, config };
         auto const cStructure = ClusterStructure{ fStructure, 3 };
 
+        auto fId = [&](NodeIndex nodeId) -> NodeIndex {
+            return fStructure.fNodeIdOf(nodeId);
+        };
+
         SECTION(".clusters()") {
             std::vector<Cluster> const expected = {
                 Cluster{ {0,5}, 14.f * blockWeight },
@@ -258,7 +266,7 @@ TEST_CASE("core::force1Solver::detail::ClusterStructure") {
         SECTION(".clusterOfNode()") {
             static constexpr auto inv = ClusterStructure::invalidClusterId();
             std::vector<ClusterIndex> const expected = {
-                inv, inv, inv, inv, // y == 0
+                inv,                // y == 0
                 0, 0, 0, 1,         // y == 1
                 0, 0, 1, 1,         // y == 2
                 0, 0, 0, 0, 0, 1,   // y == 3
@@ -281,14 +289,14 @@ TEST_CASE("core::force1Solver::detail::ClusterStructure") {
             };
 
             std::vector<ClusterContact> const expected = {
-                lowerContact(x1y1, x1y0),
-                sideContact(x5y3, x6y3),
-                lowerContact(x5y3, x5y2),
-                lowerContact(x3y1, x3y0),
-                lowerContact(x4y1, x4y0),
-                lowerContact(x6y1, x6y0),
-                upperContact(x5y2, x5y3),
-                sideContact(x6y3, x5y3),
+                lowerContact(fId(x1y1), fId(x1y0)),
+                sideContact(fId(x5y3), fId(x6y3)),
+                lowerContact(fId(x5y3), fId(x5y2)),
+                lowerContact(fId(x3y1), fId(x3y0)),
+                lowerContact(fId(x4y1), fId(x4y0)),
+                lowerContact(fId(x6y1), fId(x6y0)),
+                upperContact(fId(x5y2), fId(x5y3)),
+                sideContact(fId(x6y3), fId(x5y3)),
             };
             CHECK_THAT(cStructure.contacts(), matchers::c2::RangeEquals(expected));
         }
@@ -298,5 +306,17 @@ TEST_CASE("core::force1Solver::detail::ClusterStructure") {
             CHECK(result.data() == &cStructure.contacts()[5]);
             CHECK(result.size() == 3);
         }
+
+        SECTION("// ClusterStructure(ClusterStructure const&, F1Structure const&)") {
+            structure.setNodeMass(x5y2, 3.f * blockMass);
+            structure.setLinkConductivity(6, Conductivity{ 50.f * u.conductivity, 20.f * u.conductivity, 10.f * u.conductivity });
+            auto const newFStructure = F1Structure{ structure, config };
+            auto const refreshed = ClusterStructure{ cStructure, newFStructure };
+            auto const expected = ClusterStructure{ newFStructure, 3 };
+            CHECK_THAT(refreshed.clusters(), matchers::c2::RangeEquals(expected.clusters()));
+            CHECK_THAT(refreshed.clusterOfNode(), matchers::c2::RangeEquals(expected.clusterOfNode()));
+            CHECK_THAT(refreshed.contacts(), matchers::c2::RangeEquals(expected.contacts()));
+            CHECK(refreshed.contactSources() == expected.contactSources());
+        }
     }
 }
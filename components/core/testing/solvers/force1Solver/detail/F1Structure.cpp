@@ -119,6 +119,12 @@ TEST_CASE("core::force1Solver::detail::F1Structure") {
         CHECK(result.size() == expected.size());
     }
 
+    SECTION(".fNodeIdOf()") {
+        CHECK(fStructure.fNodeIdOf(0) == 0);
+        CHECK(fStructure.fNodeIdOf(x2y0) == x2y0);
+        CHECK(fStructure.fNodeIdOf(x4y1) == x4y1);
+    }
+
     SECTION(".fLinks()") {
         auto const expected = std::vector<F1Link>{
             {0,0},
@@ -150,6 +156,12 @@ TEST_CASE("core::force1Solver::detail::F1Structure") {
         CHECK_THAT(fStructure.fNodes(), matchers::c2::RangeEquals(expected));
     }
 
+    SECTION(".nodeContactsOf()") {
+        auto const result = fStructure.nodeContactsOf(x2y1);
+        CHECK(result.data() == fStructure.fContactsOf(x2y1).data());
+        CHECK(result.size() == 4);
+    }
+
     SECTION(".normalizedG()") {
         CHECK(fStructure.normalizedG() == NormalizedVector3{ g });
     }
@@ -157,4 +169,76 @@ TEST_CASE("core::force1Solver::detail::F1Structure") {
     SECTION(".structure()") {
         CHECK(&fStructure.structure() == &structure);
     }
+
+    SECTION("// merged foundations") {
+        auto fStructure2 = [&]() {
+            NodeIndex const x4y0 = addNode(true);
+            addLink(x4y0, x4y1, Normals::y);
+            addLink(x2y0, x4y0, Normals::x);
+            return F1Structure{ structure, config };
+        }();
+        NodeIndex const x4y0 = 8;
+
+        SECTION(".fContacts()") {
+            auto const expected = std::vector<F1Contact>{
+                // Node x1y1
+                F1Contact{ x2y1, 0, conductivity.shear(), conductivity.shear() },
+                // Node x2y0 & x4y0
+                F1Contact{ x2y1, 3, conductivity.compression(), conductivity.tensile() },
+                F1Contact{ x2y0, 7, conductivity.shear(), conductivity.shear() },
+                F1Contact{ x4y1, 6, conductivity.compression(), conductivity.tensile() },
+                F1Contact{ x2y0, 7, conductivity.shear(), conductivity.shear() },
+                // Node x2y1
+                F1Contact{ x1y1, 0, conductivity.shear(), conductivity.shear() },
+                F1Contact{ x3y1, 1, conductivity.shear(), conductivity.shear() },
+                F1Contact{ x2y0, 3, conductivity.tensile(), conductivity.compression() },
+                F1Contact{ x2y2, 4, conductivity.compression(), conductivity.tensile() },
+                // Node x2y2
+                F1Contact{ x2y1, 4, conductivity.tensile(), conductivity.compression() },
+                F1Contact{ x2y3, 5, conductivity.compression(), conductivity.tensile() },
+                // Node x2y3
+                F1Contact{ x2y2, 5, conductivity.tensile(), conductivity.compression() },
+                // Node x3y1
+                F1Contact{ x2y1, 1, conductivity.shear(), conductivity.shear() },
+                F1Contact{ x4y1, 2, conductivity.shear(), conductivity.shear() },
+                // Node x4y1
+                F1Contact{ x3y1, 2, conductivity.shear(), conductivity.shear() },
+                F1Contact{ x2y0, 6, conductivity.tensile(), conductivity.compression() },
+            };
+            CHECK_THAT(fStructure2.fContacts(), matchers::c2::RangeEquals(expected));
+        }
+
+        SECTION(".fNodeIdOf()") {
+            CHECK(fStructure2.fNodeIdOf(x4y0) == x2y0);
+            CHECK(fStructure2.fNodeIdOf(x4y1) == x4y1);
+        }
+
+        SECTION(".fNodes()") {
+            REQUIRE(fStructure2.fNodes().size() == 8);
+            F1Node const& foundation = fStructure2.fNodes()[x2y0];
+            CHECK(foundation.isFoundation);
+            CHECK(foundation.weight == 2.f * blockWeight);
+            CHECK(foundation.contactIds == F1Node::ContactIds{ 1,4 });
+        }
+
+        SECTION(".nodeContactsOf()") {
+            auto const result0 = fStructure2.nodeContactsOf(x2y0);
+            CHECK(result0.data() == &fStructure2.fContacts()[1]);
+            CHECK(result0.size() == 2);
+            auto const result1 = fStructure2.nodeContactsOf(x4y0);
+            CHECK(result1.data() == &fStructure2.fContacts()[3]);
+            CHECK(result1.size() == 2);
+        }
+
+        SECTION(".potentialsOf()") {
+            auto const fPotentials = std::vector<Real<u.potential>>{ 0.f * u.potential, 1.f * u.potential, 0.f * u.potential,
+                2.f * u.potential, 3.f * u.potential, 4.f * u.potential, 5.f * u.potential, 6.f * u.potential };
+            auto const potentials = fStructure2.potentialsOf(fPotentials);
+            REQUIRE(potentials.size() == 9);
+            CHECK(potentials[x2y0] == 0.f * u.potential);
+            CHECK(potentials[x4y0] == 0.f * u.potential);
+            CHECK(potentials[x4y1] == 6.f * u.potential);
+            CHECK_THAT(fStructure2.fPotentialsOf(potentials), matchers::c2::RangeEquals(fPotentials));
+        }
+    }
 }
@@ -84,8 +84,12 @@ TEST_CASE("core::force1Solver::detail::LayerStructure") {
     auto const fStructure = F1Structure{ structure, config };
     auto const lStructure = LayerStructure{ fStructure };
 
+    auto fId = [&](NodeIndex nodeId) -> NodeIndex {
+        return fStructure.fNodeIdOf(nodeId);
+    };
+
     SECTION(".layerOfNode()") {
-        auto const expected = std::vector<NodeIndex>{ 4,0,1,2,0,1,2,3,0,1,2,4 };
+        auto const expected = std::vector<NodeIndex>{ 4,0,1,2,1,2,3,1,2,4 };
         CHECK_THAT(lStructure.layerOfNode(), matchers::c2::RangeEquals(expected));
     }
 
@@ -110,15 +114,15 @@ TEST_CASE("core::force1Solver::detail::LayerStructure") {
             };
 
         auto const expected = std::vector<LayerContact>{
-            lowerContact(x1y1, x1y0),
-            lowerContact(x2y1, x2y0),
-            lowerContact(x4y1, x4y0),
-            lowerContact(x1y2, x1y1),
-            lowerContact(x2y2, x2y1),
-            lowerContact(x4y2, x4y1),
-            sideContact(x3y2, x2y2),
-            sideContact(x3y2, x4y2),
-            sideContact(x0y2, x1y2),
+            lowerContact(fId(x1y1), fId(x1y0)),
+            lowerContact(fId(x2y1), fId(x2y0)),
+            lowerContact(fId(x4y1), fId(x4y0)),
+            lowerContact(fId(x1y2), fId(x1y1)),
+            lowerContact(fId(x2y2), fId(x2y1)),
+            lowerContact(fId(x4y2), fId(x4y1)),
+            sideContact(fId(x3y2), fId(x2y2)),
+            sideContact(fId(x3y2), fId(x4y2)),
+            sideContact(fId(x0y2), fId(x1y2)),
         };
 
         CHECK_THAT(lStructure.lowContacts(), matchers::c2::RangeEquals(expected));
@@ -131,6 +135,29 @@ TEST_CASE("core::force1Solver::detail::LayerStructure") {
     }
 
     SECTION(".reachedCount()") {
-        CHECK(lStructure.reachedCount() == 11);
+        CHECK(lStructure.reachedCount() == 9);
+    }
+
+    SECTION("// LayerStructure(LayerStructure const&, F1Structure const&)") {
+        // Same structure, without the detached node.
+        auto solvable = Structure{};
+        for (NodeIndex nodeId = 0; nodeId < 11; ++nodeId) {
+            solvable.addNode(structure.nodes()[nodeId]);
+        }
+        for (auto const& link : structure.links()) {
+            solvable.addLink(link);
+        }
+        auto const oldLStructure = LayerStructure{ F1Structure{ solvable, config } };
+        solvable.setNodeMass(x1y2, 3.f * blockMass);
+        solvable.setNodeMass(x4y1, 2.f * blockMass);
+        solvable.setLinkConductivity(4, Conductivity{ 50.f * u.conductivity, 20.f * u.conductivity, 10.f * u.conductivity });
+        auto const newFStructure = F1Structure{ solvable, config };
+        auto const refreshed = LayerStructure{ oldLStructure, newFStructure };
+        auto const expected = LayerStructure{ newFStructure };
+        CHECK_THAT(refreshed.layers(), matchers::c2::RangeEquals(expected.layers()));
+        CHECK_THAT(refreshed.layerOfNode(), matchers::c2::RangeEquals(expected.layerOfNode()));
+        CHECK_THAT(refreshed.lowContacts(), matchers::c2::RangeEquals(expected.lowContacts()));
+        CHECK(refreshed.lowContactSources() == expected.lowContactSources());
+        CHECK(refreshed.reachedCount() == 9);
     }
 }
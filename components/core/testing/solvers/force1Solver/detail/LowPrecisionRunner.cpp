@@ -0,0 +1,79 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <gustave/core/solvers/force1Solver/detail/BasicStepRunner.hpp>
+#include <gustave/core/solvers/force1Solver/detail/LowPrecisionRunner.hpp>
+#include <gustave/utils/SerialExecutor.hpp>
+
+#include <TestHelpers.hpp>
+
+using LowPrecisionRunner = gustave::core::solvers::force1Solver::detail::LowPrecisionRunner<libCfg, cfg::withRealRep<libCfg, float>>;
+using BasicStepRunner = gustave::core::solvers::force1Solver::detail::BasicStepRunner<libCfg>;
+
+using Config = LowPrecisionRunner::Config;
+using SolverRunContext = LowPrecisionRunner::SolverRunContext;
+using Structure = LowPrecisionRunner::Structure;
+
+using Link = Structure::Link;
+using Node = Structure::Node;
+
+TEST_CASE("core::force1Solver::detail::LowPrecisionRunner") {
+    static constexpr Real<u.one> targetError = 0.001f;
+    static constexpr unsigned width = 4;
+    static constexpr unsigned height = 6;
+
+    Structure structure;
+    for (unsigned y = 0; y < height; ++y) {
+        for (unsigned x = 0; x < width; ++x) {
+            structure.addNode(Node{ 1000.f * u.mass, y == 0 });
+        }
+    }
+    auto nodeId = [](unsigned x, unsigned y) -> NodeIndex {
+        return NodeIndex(y * width + x);
+    };
+    for (unsigned y = 0; y < height; ++y) {
+        for (unsigned x = 0; x < width; ++x) {
+            if (x + 1 < width) {
+                structure.addLink(Link{ nodeId(x, y), nodeId(x + 1, y), Normals::x, 1.f * u.area, 1.f * u.length, concrete_20m });
+            }
+            if (y + 1 < height) {
+                structure.addLink(Link{ nodeId(x, y), nodeId(x, y + 1), Normals::y, 1.f * u.area, 1.f * u.length, concrete_20m });
+            }
+        }
+    }
+    auto const config = Config{ g, targetError };
+
+    SECTION(".run()") {
+        SolverRunContext ctx{ structure, config };
+        auto executor = gustave::utils::SerialExecutor{};
+        LowPrecisionRunner{ ctx }.run(executor);
+        CHECK(ctx.iterationIndex > 0);
+        CHECK(ctx.potentials[nodeId(0, height - 1)] != 0.f * u.potential);
+        auto const stepResult = BasicStepRunner{ ctx }.runStep();
+        CHECK(stepResult.maxError < 2.f * targetError);
+    }
+}
@@ -23,7 +23,11 @@
  * SOFTWARE.
  */
 
+#include <algorithm>
+#include <chrono>
+#include <optional>
 #include <stdexcept>
+#include <vector>
 
 #include <gustave/core/worlds/SyncWorld.hpp>
 
@@ -59,6 +63,47 @@ TEST_CASE("core::worlds::SyncWorld") {
     SECTION(".modify()") {
         CHECK(trRes.newStructures().size() == 1);
         CHECK(trRes.deletedStructures().size() == 0);
+
+        SECTION("// material change") {
+            auto const structureId = *trRes.newStructures().begin();
+            transaction.clear();
+            transaction.changeMaterial(SyncWorld::Transaction::MaterialChange{ 0, concrete_40m, 2.f * u.one });
+            auto const res2 = world.modify(transaction);
+            CHECK(res2.newStructures().size() == 0);
+            CHECK(res2.deletedStructures().size() == 0);
+            REQUIRE(res2.modifiedStructures().size() == 1);
+            CHECK(res2.modifiedStructures()[0] == structureId);
+
+            auto const structure = world.structures().at(structureId);
+            CHECK(structure.state() == SyncWorld::StructureReference::State::Solved);
+            CHECK(world.blocks().at({ 0,2,0 }).mass() == 2.f * blockMass);
+            auto const contact = world.contacts().at(ContactIndex{ {0,0,0}, Direction::plusY() });
+            CHECK_THAT(contact.forceVector(), matchers::WithinRel(18.f * blockMass * g, solverPrecision));
+        }
+
+        SECTION("// block modification") {
+            auto const structureId = *trRes.newStructures().begin();
+            transaction.clear();
+            transaction.modifyBlock({ {0,9,0}, concrete_20m, 11.f * blockMass });
+            auto const res2 = world.modify(transaction);
+            CHECK(res2.newStructures().size() == 0);
+            CHECK(res2.deletedStructures().size() == 0);
+            CHECK(res2.modifiedStructures() == std::vector{ structureId });
+
+            CHECK(world.structures().at(structureId).state() == SyncWorld::StructureReference::State::Solved);
+            auto const contact = world.contacts().at(ContactIndex{ {0,0,0}, Direction::plusY() });
+            CHECK_THAT(contact.forceVector(), matchers::WithinRel(19.f * blockMass * g, solverPrecision));
+        }
+
+        SECTION("// change record") {
+            SyncWorld::ChangeRecord changes{ 0.f * u.one };
+            transaction.clear();
+            transaction.modifyBlock({ {0,9,0}, concrete_20m, 11.f * blockMass });
+            world.modify(transaction, changes);
+            CHECK(changes.addedBlocks().empty());
+            CHECK(changes.removedBlocks().empty());
+            CHECK(changes.stressChanges().size() == 10);
+        }
     }
 
     SECTION(".blocks()") {
@@ -83,6 +128,158 @@ TEST_CASE("core::worlds::SyncWorld") {
         CHECK_THAT(result, matchers::c2::UnorderedRangeEquals(expected));
     }
 
+    SECTION("// terrain") {
+        auto solver = Solver{ Solver::Config{ g, solverPrecision } };
+        auto terrainWorld = SyncWorld{ blockSize, SyncWorld::Terrain::heightField([](auto, auto) { return 0; }, concrete_20m), std::move(solver) };
+        transaction.clear();
+        for (int i = 0; i < 4; ++i) {
+            transaction.addBlock({ {0,i,0}, concrete_20m, blockMass, false });
+        }
+        auto const res = terrainWorld.modify(transaction);
+        REQUIRE(res.newStructures().size() == 1);
+        auto const structure = terrainWorld.structures().at(*res.newStructures().begin());
+        CHECK(structure.state() == SyncWorld::StructureReference::State::Solved);
+        auto const contact = terrainWorld.contacts().at(ContactIndex{ {0,0,0}, Direction::plusY() });
+        CHECK_THAT(contact.forceVector(), matchers::WithinRel(3.f * blockMass * g, solverPrecision));
+
+        SECTION("// ground contacts") {
+            auto const groundId = ContactIndex{ {0,0,0}, Direction::minusY() };
+            auto const groundContact = terrainWorld.contacts().at(groundId);
+            CHECK(groundContact.isGroundContact());
+            CHECK_FALSE(contact.isGroundContact());
+            CHECK_THAT(groundContact.forceVector(), matchers::WithinRel(-4.f * blockMass * g, solverPrecision));
+            CHECK_FALSE(groundContact.otherBlock().isValid());
+
+            auto const groundRatio = groundContact.stressRatio().compression();
+            CHECK(groundRatio > contact.stressRatio().compression());
+            CHECK_THAT(terrainWorld.blocks().at({ 0,0,0 }).stressRatio().compression(), matchers::WithinRel(groundRatio, solverPrecision));
+            CHECK(structure.stats().weakestLink() == groundId);
+            CHECK(structure.stats().maxStressRatio().compression() == groundRatio);
+
+            std::vector<ContactIndex> links;
+            for (auto const& link : structure.links()) {
+                links.push_back(link.index());
+            }
+            CHECK(std::ranges::count(links, groundId) == 1);
+            CHECK(links.size() == 4);
+        }
+    }
+
+    SECTION(".setSolutionMemoryBudget()") {
+        auto const pillarId = trRes.newStructures().at(0);
+        transaction.clear();
+        transaction.addBlock({ {2,0,0}, concrete_20m, blockMass, true });
+        transaction.addBlock({ {2,1,0}, concrete_20m, blockMass, false });
+        auto const smallId = world.modify(transaction).newStructures().at(0);
+        auto const& pillarData = world.scene().structures().at(pillarId).userData();
+        auto const& smallData = world.scene().structures().at(smallId).userData();
+        auto const pillarContact = world.contacts().at(ContactIndex{ {0,0,0}, Direction::plusY() });
+        CHECK(world.solutionMemoryUsage() == 0);
+
+        SECTION("// zero") {
+            world.setSolutionMemoryBudget(0);
+            CHECK(pillarData.isEvicted());
+            CHECK(smallData.isEvicted());
+            CHECK(world.solutionMemoryUsage() == 0);
+
+            CHECK_THAT(pillarContact.forceVector(), matchers::WithinRel(9.f * blockMass * g, solverPrecision));
+            CHECK_FALSE(pillarData.isEvicted());
+            CHECK(world.solutionMemoryUsage() == pillarData.solutionMemoryUsage());
+
+            transaction.clear();
+            transaction.modifyBlock({ {2,1,0}, concrete_20m, 2.f * blockMass });
+            world.modify(transaction);
+            CHECK(pillarData.isEvicted());
+            CHECK(smallData.isEvicted());
+            CHECK(world.solutionMemoryUsage() == 0);
+            auto const smallContact = world.contacts().at(ContactIndex{ {2,0,0}, Direction::plusY() });
+            CHECK_THAT(smallContact.forceVector(), matchers::WithinRel(2.f * blockMass * g, solverPrecision));
+        }
+
+        SECTION("// least recently used") {
+            auto const pillarMemory = pillarData.solutionMemoryUsage();
+            auto const smallMemory = smallData.solutionMemoryUsage();
+            world.setSolutionMemoryBudget(pillarMemory + smallMemory);
+            REQUIRE(world.solutionMemoryBudget());
+            CHECK(*world.solutionMemoryBudget() == pillarMemory + smallMemory);
+            CHECK(world.solutionMemoryUsage() == pillarMemory + smallMemory);
+
+            CHECK_THAT(pillarContact.forceVector(), matchers::WithinRel(9.f * blockMass * g, solverPrecision));
+            world.setSolutionMemoryBudget(pillarMemory);
+            CHECK_FALSE(pillarData.isEvicted());
+            CHECK(smallData.isEvicted());
+            CHECK(world.solutionMemoryUsage() == pillarMemory);
+        }
+
+        SECTION("// disable") {
+            world.setSolutionMemoryBudget(0);
+            world.setSolutionMemoryBudget(std::nullopt);
+            CHECK_FALSE(world.solutionMemoryBudget());
+            CHECK(pillarData.isEvicted());
+            CHECK(world.structures().at(pillarId).state() == SyncWorld::StructureReference::State::Solved);
+            CHECK_THAT(pillarContact.forceVector(), matchers::WithinRel(9.f * blockMass * g, solverPrecision));
+            CHECK_FALSE(pillarData.isEvicted());
+            CHECK(world.solutionMemoryUsage() == 0);
+        }
+    }
+
+    SECTION(".snapshot()") {
+        auto const snapshot = world.snapshot();
+        CHECK(snapshot->blockCount() == 10);
+        CHECK(snapshot->structureCount() == 1);
+        CHECK(world.snapshot() == snapshot);
+
+        transaction.clear();
+        transaction.removeBlock({ 0,9,0 });
+        world.modify(transaction);
+        CHECK(snapshot->findBlock({ 0,9,0 }) != nullptr);
+        CHECK(world.snapshot()->findBlock({ 0,9,0 }) == nullptr);
+    }
+
+    SECTION(".solvePending()") {
+        world.setSolveMode(SyncWorld::SolveMode::Lazy);
+        CHECK(world.solveMode() == SyncWorld::SolveMode::Lazy);
+        transaction.clear();
+        transaction.modifyBlock({ {0,9,0}, concrete_20m, 11.f * blockMass });
+        auto const res2 = world.modify(transaction);
+        auto const& structureData = world.scene().structures().at(res2.modifiedStructures().at(0)).userData();
+        CHECK(structureData.isPending());
+
+        SECTION("// explicit") {
+            SyncWorld::ChangeRecord changes{ 0.f * u.one };
+            world.solvePending(changes);
+            CHECK_FALSE(structureData.isPending());
+            CHECK(changes.stressChanges().size() == 10);
+        }
+
+        SECTION("// budget") {
+            transaction.clear();
+            transaction.addBlock({ {2,0,0}, concrete_20m, blockMass, true });
+            transaction.addBlock({ {2,1,0}, concrete_20m, blockMass, false });
+            auto const res3 = world.modify(transaction);
+            auto const structureId = res3.newStructures().at(0);
+            world.setStructurePriority(structureId, 1.f * u.one);
+            CHECK(world.structures().at(structureId).priority() == 1.f);
+            world.solvePending(std::chrono::nanoseconds{ 0 });
+            CHECK(structureData.isPending());
+            world.solvePending(std::chrono::nanoseconds{ 0 });
+            CHECK_FALSE(structureData.isPending());
+        }
+
+        SECTION("// on first read") {
+            auto const contact = world.contacts().at(ContactIndex{ {0,0,0}, Direction::plusY() });
+            CHECK_THAT(contact.forceVector(), matchers::WithinRel(19.f * blockMass * g, solverPrecision));
+            CHECK_FALSE(structureData.isPending());
+        }
+
+        SECTION("// snapshot") {
+            auto const snapshot = world.snapshot();
+            CHECK_FALSE(structureData.isPending());
+            REQUIRE(snapshot->findBlock({ 0,0,0 }) != nullptr);
+            CHECK(snapshot->findBlock({ 0,0,0 })->stressRatio() == world.blocks().at({ 0,0,0 }).stressRatio());
+        }
+    }
+
     SECTION(".structures()") {
         auto const structureIt = world.structures().begin();
         REQUIRE(structureIt != world.structures().end());
@@ -88,6 +88,15 @@ TEST_CASE("core::worlds::syncWorld::Blocks") {
         CHECK_FALSE(blocks.find({ 0,0,1 }).isValid());
     }
 
+    SECTION(".inRegion()") {
+        std::vector<BlockIndex> indices;
+        for (auto const& block : blocks.inRegion({ {0,1,0}, {0,2,0} })) {
+            indices.push_back(block.index());
+        }
+        std::vector<BlockIndex> expected{ {0,1,0},{0,2,0} };
+        CHECK_THAT(indices, matchers::c2::UnorderedRangeEquals(expected));
+    }
+
     SECTION(".size()") {
         CHECK(blocks.size() == 4);
     }
@@ -300,4 +300,22 @@ TEST_CASE("core::worlds::syncWorld::ContactReference") {
             CHECK(contact.structure() == expectedStruct);
         }
     }
+
+    SECTION(".view()") {
+        SECTION("// valid") {
+            auto const view = c5.view();
+            CHECK(view.index() == c5.index());
+            CHECK(view.isSolved());
+            CHECK(view.forceVector() == c5.forceVector());
+            CHECK(view.stressRatio() == c5.stressRatio());
+        }
+
+        SECTION("// invalid") {
+            CHECK_THROWS_AS(invalidContact.view(), std::out_of_range);
+        }
+
+        SECTION("// unsolved") {
+            CHECK_THROWS_AS(unsolvedContact.view(), std::logic_error);
+        }
+    }
 }
@@ -40,6 +40,7 @@ using ContactReference = StructureReference::ContactReference;
 using Direction = ContactIndex::Direction;
 using Solver = WorldData::Solver;
 using State = StructureReference::State;
+using StressRatio = StructureReference::StructureStats::StressRatio;
 using Transaction = WorldData::Scene::Transaction;
 
 static constexpr auto blockSize = vector3(3.f, 2.f, 1.f, u.length);
@@ -138,6 +139,25 @@ TEST_CASE("core::worlds::syncWorld::StructureReference") {
         }
     }
 
+    SECTION(".blockViews()") {
+        SECTION("// invalid structure") {
+            CHECK_THROWS_AS(sInvalid.blockViews(), std::out_of_range);
+        }
+
+        SECTION(".begin() // & .end()") {
+            std::vector<BlockIndex> indices;
+            for (auto const& block : s010.blockViews()) {
+                indices.push_back(block.index());
+            }
+            std::vector<BlockIndex> expected = { {0,0,0},{0,1,0},{0,2,0},{0,3,0} };
+            CHECK_THAT(indices, matchers::c2::UnorderedRangeEquals(expected));
+        }
+
+        SECTION(".size()") {
+            CHECK(s010.blockViews().size() == 4);
+        }
+    }
+
     SECTION(".contacts()") {
         SECTION("// invalid structure") {
             CHECK_THROWS_AS(sInvalid.contacts(), std::out_of_range);
@@ -253,6 +273,36 @@ TEST_CASE("core::worlds::syncWorld::StructureReference") {
         }
     }
 
+    SECTION(".linkViews()") {
+        SECTION("// invalid structure") {
+            CHECK_THROWS_AS(sInvalid.linkViews(), std::out_of_range);
+        }
+
+        SECTION("// solved") {
+            std::vector<ContactIndex> indices;
+            for (auto const& view : s010.linkViews()) {
+                auto const contact = ContactReference{ world, view.index() };
+                CHECK(view.isSolved());
+                CHECK(view.forceVector() == contact.forceVector());
+                CHECK(view.stressRatio() == contact.stressRatio());
+                indices.push_back(view.index());
+            }
+            std::vector<ContactIndex> expected = {
+                ContactIndex{ {0,0,0}, Direction::plusY() },
+                ContactIndex{ {0,1,0}, Direction::plusY() },
+                ContactIndex{ {0,2,0}, Direction::plusY() },
+            };
+            CHECK_THAT(indices, matchers::c2::UnorderedRangeEquals(expected));
+        }
+
+        SECTION("// not solved") {
+            auto const view = *s202.linkViews().begin();
+            CHECK(view.index() == ContactIndex{ {2,0,2}, Direction::plusY() });
+            CHECK_FALSE(view.isSolved());
+            CHECK_THROWS_AS(view.forceVector(), std::logic_error);
+        }
+    }
+
     SECTION(".links()") {
         SECTION("// invalid structure") {
             CHECK_THROWS_AS(sInvalid.links(), std::out_of_range);
@@ -273,6 +323,18 @@ TEST_CASE("core::worlds::syncWorld::StructureReference") {
         }
     }
 
+    SECTION(".priority()") {
+        SECTION("// invalid structure") {
+            CHECK_THROWS_AS(sInvalid.priority(), std::out_of_range);
+        }
+
+        SECTION("// valid") {
+            CHECK(s010.priority() == 0.f);
+            world.scene.structures().at(s010.index()).userData().setPriority(2.f * u.one);
+            CHECK(s010.priority() == 2.f);
+        }
+    }
+
     SECTION(".state()") {
         SECTION("// solved") {
             CHECK(s010.state() == State::Solved);
@@ -287,4 +349,34 @@ TEST_CASE("core::worlds::syncWorld::StructureReference") {
             CHECK(sInvalid.state() == State::Invalid);
         }
     }
+
+    SECTION(".stats()") {
+        SECTION("// invalid structure") {
+            CHECK_THROWS_AS(sInvalid.stats(), std::out_of_range);
+        }
+
+        SECTION("// solved") {
+            auto const& stats = s010.stats();
+            CHECK(stats.blockCount() == 4);
+            CHECK(stats.mass() == 4.f * blockMass);
+            CHECK(stats.massCenter() == vector3(0.f, 3.f, 0.f, u.length));
+
+            auto expectedRatio = StressRatio{ 0.f * u.one, 0.f * u.one, 0.f * u.one };
+            for (auto const& view : s010.linkViews()) {
+                expectedRatio.mergeMax(view.stressRatio());
+            }
+            CHECK(stats.maxStressRatio() == expectedRatio);
+            REQUIRE(stats.weakestLink());
+            CHECK(s010.contacts().at(*stats.weakestLink()).stressRatio().maxCoord() == expectedRatio.maxCoord());
+            CHECK_FALSE(stats.isOverloaded());
+        }
+
+        SECTION("// not solved") {
+            auto const& stats = s202.stats();
+            CHECK(stats.blockCount() == 2);
+            CHECK(stats.mass() == 2.f * blockMass);
+            CHECK_FALSE(stats.weakestLink());
+            CHECK_FALSE(stats.isOverloaded());
+        }
+    }
 }
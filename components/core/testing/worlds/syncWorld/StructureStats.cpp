@@ -0,0 +1,73 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gustave/core/worlds/syncWorld/StructureStats.hpp>
+
+#include <TestHelpers.hpp>
+
+using StructureStats = gustave::core::worlds::syncWorld::StructureStats<libCfg>;
+
+using ContactIndex = StructureStats::ContactIndex;
+using Direction = ContactIndex::Direction;
+using StressRatio = StructureStats::StressRatio;
+
+TEST_CASE("core::worlds::syncWorld::StructureStats") {
+    StructureStats stats;
+
+    SECTION("// empty") {
+        CHECK(stats.blockCount() == 0);
+        CHECK(stats.mass() == 0.f * u.mass);
+        CHECK(stats.maxStressRatio() == StressRatio{ 0.f * u.one, 0.f * u.one, 0.f * u.one });
+        CHECK_FALSE(stats.weakestLink());
+        CHECK_FALSE(stats.isOverloaded());
+    }
+
+    SECTION(".addBlock()") {
+        stats.addBlock(1000.f * u.mass, vector3(0.f, 2.f, 0.f, u.length));
+        stats.addBlock(3000.f * u.mass, vector3(4.f, 6.f, 0.f, u.length));
+        CHECK(stats.blockCount() == 2);
+        CHECK(stats.mass() == 4000.f * u.mass);
+        CHECK(stats.massCenter() == vector3(3.f, 5.f, 0.f, u.length));
+    }
+
+    SECTION(".addLink()") {
+        auto const link1 = ContactIndex{ {0,0,0}, Direction::plusY() };
+        auto const link2 = ContactIndex{ {0,1,0}, Direction::plusX() };
+        auto const link3 = ContactIndex{ {0,1,0}, Direction::plusY() };
+        stats.addLink(link1, StressRatio{ 0.5f * u.one, 0.1f * u.one, 0.f * u.one });
+        stats.addLink(link2, StressRatio{ 0.f * u.one, 0.75f * u.one, 0.25f * u.one });
+        stats.addLink(link3, StressRatio{ 0.25f * u.one, 0.f * u.one, 0.5f * u.one });
+
+        CHECK(stats.maxStressRatio() == StressRatio{ 0.5f * u.one, 0.75f * u.one, 0.5f * u.one });
+        CHECK(stats.weakestLink() == link2);
+        CHECK_FALSE(stats.isOverloaded());
+
+        SECTION("// overloaded") {
+            stats.addLink(link3, StressRatio{ 0.f * u.one, 0.f * u.one, 1.5f * u.one });
+            CHECK(stats.weakestLink() == link3);
+            CHECK(stats.isOverloaded());
+        }
+    }
+}
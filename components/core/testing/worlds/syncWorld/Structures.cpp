@@ -97,6 +97,11 @@ TEST_CASE("core::worlds::syncWorld::Structures") {
         }
     }
 
+    SECTION(".intersecting()") {
+        std::vector<StructureReference> expected = { structureOf({0,2,0}) };
+        CHECK_THAT(structures.intersecting({ {0,2,0}, {5,5,5} }), matchers::c2::UnorderedRangeEquals(expected));
+    }
+
     SECTION(".size()") {
         CHECK(structures.size() == 2);
     }
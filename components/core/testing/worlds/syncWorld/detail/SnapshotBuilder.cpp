@@ -0,0 +1,147 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <memory>
+
+#include <gustave/core/worlds/syncWorld/detail/SnapshotBuilder.hpp>
+#include <gustave/core/worlds/syncWorld/detail/WorldData.hpp>
+#include <gustave/core/worlds/syncWorld/detail/WorldUpdater.hpp>
+#include <gustave/core/worlds/syncWorld/BlockReference.hpp>
+
+#include <TestHelpers.hpp>
+
+using SnapshotBuilder = gustave::core::worlds::syncWorld::detail::SnapshotBuilder<libCfg>;
+using WorldData = gustave::core::worlds::syncWorld::detail::WorldData<libCfg>;
+using WorldUpdater = gustave::core::worlds::syncWorld::detail::WorldUpdater<libCfg>;
+
+using BlockIndex = WorldData::Scene::BlockIndex;
+using BlockReference = gustave::core::worlds::syncWorld::BlockReference<libCfg>;
+using Solver = WorldData::Solver;
+using Transaction = WorldUpdater::Transaction;
+
+static constexpr auto blockSize = vector3(3.f, 2.f, 1.f, u.length);
+static constexpr Real<u.density> concreteDensity = 2'400.f * u.density;
+static constexpr Real<u.mass> blockMass = blockSize.x() * blockSize.y() * blockSize.z() * concreteDensity;
+static constexpr float solverPrecision = 0.001f;
+
+[[nodiscard]]
+static WorldData makeWorld() {
+    auto solver = Solver{ Solver::Config{ g, solverPrecision } };
+    return WorldData{ blockSize, std::move(solver) };
+}
+
+TEST_CASE("core::worlds::syncWorld::detail::SnapshotBuilder") {
+    WorldData world = makeWorld();
+
+    {
+        Transaction t;
+        t.addBlock({ {0,0,0}, concrete_20m, blockMass, true });
+        t.addBlock({ {0,1,0}, concrete_20m, blockMass, false });
+        t.addBlock({ {0,2,0}, concrete_20m, blockMass, false });
+        t.addBlock({ {100,0,0}, concrete_20m, blockMass, true });
+        t.addBlock({ {100,1,0}, concrete_20m, blockMass, false });
+        t.addBlock({ {100,2,0}, concrete_20m, blockMass, false });
+        WorldUpdater{ world }.runTransaction(t);
+    }
+
+    auto structureIdOf = [&](BlockIndex const& index) {
+        return world.scene.blocks().at(index).structures().unique().index();
+    };
+
+    auto runTransaction = [&](Transaction const& transaction) {
+        WorldUpdater{ world }.runTransaction(transaction);
+    };
+
+    auto const snapshot1 = SnapshotBuilder{ world }.run();
+
+    SECTION("// initial state") {
+        CHECK(snapshot1->blockCount() == 6);
+        CHECK(snapshot1->structureCount() == 2);
+
+        auto const block = snapshot1->findBlock({ 0,1,0 });
+        REQUIRE(block != nullptr);
+        CHECK(block->mass() == blockMass);
+        CHECK(block->maxPressureStress() == concrete_20m);
+        CHECK_FALSE(block->isFoundation());
+        CHECK(block->structureIndex() == structureIdOf({ 0,1,0 }));
+        CHECK(block->stressRatio() == BlockReference{ world, { 0,1,0 } }.stressRatio());
+
+        auto const foundation = snapshot1->findBlock({ 0,0,0 });
+        REQUIRE(foundation != nullptr);
+        CHECK(foundation->isFoundation());
+        CHECK_FALSE(foundation->structureIndex());
+
+        CHECK(snapshot1->findBlock({ 0,3,0 }) == nullptr);
+
+        auto const structureId = structureIdOf({ 0,1,0 });
+        auto const structure = snapshot1->findStructure(structureId);
+        REQUIRE(structure != nullptr);
+        CHECK(structure->isSolved());
+        CHECK(structure->stats().blockCount() == 3);
+        CHECK(structure->solutionPtr() == world.scene.structures().at(structureId).userData().solutionPtr());
+    }
+
+    SECTION("// no modification") {
+        CHECK(SnapshotBuilder{ world }.run() == snapshot1);
+    }
+
+    SECTION("// modification") {
+        auto const oldStructureId = structureIdOf({ 100,1,0 });
+        Transaction t;
+        t.removeBlock({ 100,2,0 });
+        runTransaction(t);
+        auto const snapshot2 = SnapshotBuilder{ world }.run();
+
+        CHECK(snapshot1->blockCount() == 6);
+        REQUIRE(snapshot1->findBlock({ 100,2,0 }) != nullptr);
+        CHECK(snapshot1->findStructure(oldStructureId) != nullptr);
+
+        CHECK(snapshot2->blockCount() == 5);
+        CHECK(snapshot2->findBlock({ 100,2,0 }) == nullptr);
+        CHECK(snapshot2->findStructure(oldStructureId) == nullptr);
+        auto const newStructureId = structureIdOf({ 100,1,0 });
+        REQUIRE(snapshot2->findStructure(newStructureId) != nullptr);
+        CHECK(snapshot2->findBlock({ 100,1,0 })->structureIndex() == newStructureId);
+        CHECK(snapshot2->findBlock({ 100,1,0 })->stressRatio() == BlockReference{ world, { 100,1,0 } }.stressRatio());
+
+        // Untouched chunks and structures are shared.
+        CHECK(snapshot2->findBlock({ 0,1,0 }) == snapshot1->findBlock({ 0,1,0 }));
+        auto const unchangedId = structureIdOf({ 0,1,0 });
+        CHECK(snapshot2->findStructure(unchangedId) == snapshot1->findStructure(unchangedId));
+    }
+
+    SECTION("// material change") {
+        Transaction t;
+        t.changeMaterial(Transaction::MaterialChange{ 0, concrete_40m, 2.f * u.one });
+        runTransaction(t);
+        auto const snapshot2 = SnapshotBuilder{ world }.run();
+
+        CHECK(snapshot1->findBlock({ 100,0,0 })->mass() == blockMass);
+        CHECK(snapshot2->findBlock({ 100,0,0 })->mass() == 2.f * blockMass);
+        CHECK(snapshot2->findBlock({ 0,2,0 })->maxPressureStress() == concrete_40m);
+        CHECK(snapshot2->blockCount() == 6);
+        CHECK(snapshot2->structureCount() == 2);
+    }
+}
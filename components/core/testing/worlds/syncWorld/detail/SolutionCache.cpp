@@ -0,0 +1,112 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <optional>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <gustave/core/worlds/syncWorld/detail/SolutionCache.hpp>
+
+#include <TestHelpers.hpp>
+
+using SolutionCache = gustave::core::worlds::syncWorld::detail::SolutionCache<libCfg>;
+
+TEST_CASE("core::worlds::syncWorld::detail::SolutionCache") {
+    SolutionCache cache;
+
+    SECTION("// disabled") {
+        CHECK_FALSE(cache.isEnabled());
+        CHECK_FALSE(cache.isOverBudget());
+        CHECK(cache.usedMemory() == 0);
+    }
+
+    SECTION("// enabled") {
+        cache.setBudget(100);
+        cache.insert(1, 30);
+        cache.insert(2, 40);
+        cache.insert(3, 20);
+
+        SECTION(".budget()") {
+            REQUIRE(cache.budget());
+            CHECK(*cache.budget() == 100);
+        }
+
+        SECTION(".erase()") {
+            cache.erase(2);
+            CHECK_FALSE(cache.contains(2));
+            CHECK(cache.size() == 2);
+            CHECK(cache.usedMemory() == 50);
+        }
+
+        SECTION(".insert()") {
+            SECTION("// new") {
+                cache.insert(4, 20);
+                CHECK(cache.usedMemory() == 110);
+                CHECK(cache.isOverBudget());
+                CHECK(cache.leastRecentlyUsed() == 1);
+            }
+
+            SECTION("// replace") {
+                cache.insert(1, 10);
+                CHECK(cache.size() == 3);
+                CHECK(cache.usedMemory() == 70);
+                CHECK(cache.leastRecentlyUsed() == 2);
+            }
+        }
+
+        SECTION(".leastRecentlyUsed()") {
+            CHECK(cache.leastRecentlyUsed() == 1);
+        }
+
+        SECTION(".setBudget()") {
+            SECTION("// lower") {
+                cache.setBudget(80);
+                CHECK(cache.isOverBudget());
+                CHECK(cache.usedMemory() == 90);
+            }
+
+            SECTION("// disable") {
+                cache.setBudget(std::nullopt);
+                CHECK_FALSE(cache.isEnabled());
+                CHECK(cache.size() == 0);
+                CHECK(cache.usedMemory() == 0);
+            }
+        }
+
+        SECTION(".touch()") {
+            cache.touch(1);
+            CHECK(cache.leastRecentlyUsed() == 2);
+            cache.touch(2);
+            CHECK(cache.leastRecentlyUsed() == 3);
+            cache.touch(7);
+            CHECK(cache.size() == 3);
+        }
+
+        SECTION(".usedMemory()") {
+            CHECK(cache.usedMemory() == 90);
+            CHECK_FALSE(cache.isOverBudget());
+        }
+    }
+}
@@ -23,18 +23,27 @@
  * SOFTWARE.
  */
 
+#include <chrono>
+#include <unordered_set>
+#include <vector>
+
 #include <gustave/core/worlds/syncWorld/detail/WorldData.hpp>
 #include <gustave/core/worlds/syncWorld/detail/WorldUpdater.hpp>
+#include <gustave/core/worlds/syncWorld/BlockReference.hpp>
+#include <gustave/utils/ThreadPool.hpp>
 
 #include <TestHelpers.hpp>
 
 using WorldData = gustave::core::worlds::syncWorld::detail::WorldData<libCfg>;
 using WorldUpdater = gustave::core::worlds::syncWorld::detail::WorldUpdater<libCfg>;
 
+using BlockReference = gustave::core::worlds::syncWorld::BlockReference<libCfg>;
+using ChangeRecord = WorldUpdater::ChangeRecord;
 using Solver = WorldData::Solver;
 using StructureState = WorldData::StructureState;
 using Transaction = WorldUpdater::Transaction;
 using BlockIndex = WorldData::Scene::BlockIndex;
+using BlockRegion = WorldData::Scene::BlockRegion;
 
 static constexpr auto blockSize = vector3(3.f, 2.f, 1.f, u.length);
 static constexpr Real<u.density> concreteDensity = 2'400.f * u.density;
@@ -113,4 +122,192 @@ TEST_CASE("core::worlds::syncWorld::detail::WorldUpdater") {
             checkForce({ 0,0,0 }, { 0,1,0 }, blockMass * g);
         }
     }
+
+    SECTION(".runTransaction(Transaction const&, cExecutor auto&)") {
+        auto pool = gustave::utils::ThreadPool{ 3 };
+        WorldUpdater::Transaction t;
+        for (int x = 0; x < 8; x += 2) {
+            t.addBlock({ {x,0,0}, concrete_20m, blockMass, true });
+            t.addBlock({ {x,1,0}, concrete_20m, blockMass, false });
+            t.addBlock({ {x,2,0}, concrete_20m, blockMass, false });
+        }
+        auto const trResult = WorldUpdater{ world }.runTransaction(t, pool);
+        CHECK(trResult.newStructures().size() == 4);
+        for (auto const& sceneStructure : world.scene.structures()) {
+            CHECK(sceneStructure.userData().state() == StructureState::Solved);
+        }
+        for (int x = 0; x < 8; x += 2) {
+            checkForce({ x,0,0 }, { x,1,0 }, 2.f * blockMass * g);
+            checkForce({ x,1,0 }, { x,2,0 }, blockMass * g);
+        }
+
+        t.clear();
+        t.modifyBlock({ {0,2,0}, concrete_20m, 2.f * blockMass });
+        t.modifyBlock({ {4,2,0}, concrete_20m, 2.f * blockMass });
+        auto const trResult2 = WorldUpdater{ world }.runTransaction(t, pool);
+        CHECK(trResult2.modifiedStructures().size() == 2);
+        checkForce({ 0,0,0 }, { 0,1,0 }, 3.f * blockMass * g);
+        checkForce({ 4,1,0 }, { 4,2,0 }, 2.f * blockMass * g);
+    }
+
+    SECTION(".runTransaction(Transaction const&, ChangeRecord&)") {
+        ChangeRecord changes{ 0.001f * u.one };
+
+        auto stressIndicesOf = [](ChangeRecord const& record) {
+            std::vector<BlockIndex> result;
+            for (auto const& change : record.stressChanges()) {
+                result.push_back(change.index());
+            }
+            return result;
+        };
+
+        WorldUpdater::Transaction t;
+        t.addBlock({ {0,0,0}, concrete_20m, blockMass, true });
+        t.addBlock({ {0,1,0}, concrete_20m, blockMass, false });
+        t.addBlock({ {0,2,0}, concrete_20m, blockMass, false });
+        auto const trRes1 = WorldUpdater{ world }.runTransaction(t, changes);
+
+        SECTION("// new structure") {
+            std::vector<BlockIndex> const expectedBlocks = { {0,0,0},{0,1,0},{0,2,0} };
+            CHECK_THAT(changes.addedBlocks(), matchers::c2::UnorderedRangeEquals(expectedBlocks));
+            CHECK(changes.removedBlocks().empty());
+            CHECK(changes.newStructures() == std::vector{ trRes1.newStructures().at(0) });
+            CHECK(changes.modifiedStructures().empty());
+            CHECK(changes.deletedStructures().empty());
+            CHECK(changes.stressChanges().empty());
+        }
+
+        SECTION("// added block") {
+            t.clear();
+            t.addBlock({ {0,3,0}, concrete_20m, blockMass, false });
+            WorldUpdater{ world }.runTransaction(t, changes);
+            CHECK(changes.addedBlocks() == std::vector<BlockIndex>{ {0,3,0} });
+            std::vector<BlockIndex> const expectedStresses = { {0,0,0},{0,1,0},{0,2,0} };
+            CHECK_THAT(stressIndicesOf(changes), matchers::c2::UnorderedRangeEquals(expectedStresses));
+            for (auto const& change : changes.stressChanges()) {
+                CHECK(change.newStressRatio().maxCoord() > change.oldStressRatio().maxCoord());
+                CHECK(change.newStressRatio() == BlockReference{ world, change.index() }.stressRatio());
+            }
+        }
+
+        SECTION("// modified block") {
+            t.clear();
+            t.modifyBlock({ {0,2,0}, concrete_20m, 2.f * blockMass });
+            WorldUpdater{ world }.runTransaction(t, changes);
+            CHECK(changes.addedBlocks().empty());
+            CHECK(changes.newStructures().empty());
+            CHECK(changes.modifiedStructures() == std::vector{ trRes1.newStructures().at(0) });
+            CHECK(changes.deletedStructures().empty());
+        }
+
+        SECTION("// overlapping cleared regions") {
+            t.clear();
+            t.removeBlock({ 0,2,0 });
+            t.clearRegion(BlockRegion{ {0,1,0}, {0,2,0} });
+            t.clearRegion(BlockRegion{ {0,1,0}, {0,5,0} });
+            WorldUpdater{ world }.runTransaction(t, changes);
+            std::vector<BlockIndex> const expectedBlocks = { {0,1,0},{0,2,0} };
+            CHECK_THAT(changes.removedBlocks(), matchers::c2::UnorderedRangeEquals(expectedBlocks));
+        }
+
+        SECTION("// removed block") {
+            t.clear();
+            t.removeBlock({ 0,2,0 });
+            auto const trRes2 = WorldUpdater{ world }.runTransaction(t, changes);
+            CHECK(changes.addedBlocks().empty());
+            CHECK(changes.removedBlocks() == std::vector<BlockIndex>{ {0,2,0} });
+            CHECK(changes.newStructures() == std::vector{ trRes2.newStructures().at(0) });
+            CHECK(changes.deletedStructures() == trRes2.deletedStructures());
+            std::vector<BlockIndex> const expectedStresses = { {0,0,0},{0,1,0} };
+            CHECK_THAT(stressIndicesOf(changes), matchers::c2::UnorderedRangeEquals(expectedStresses));
+            for (auto const& change : changes.stressChanges()) {
+                CHECK(change.newStressRatio().maxCoord() < change.oldStressRatio().maxCoord());
+            }
+        }
+
+        SECTION("// removed structure") {
+            t.clear();
+            t.removeBlock({ 0,2,0 });
+            t.removeBlock({ 0,1,0 });
+            WorldUpdater{ world }.runTransaction(t, changes);
+            CHECK(changes.newStructures().empty());
+            CHECK(changes.deletedStructures().size() == 1);
+            REQUIRE(changes.stressChanges().size() == 1);
+            auto const& change = changes.stressChanges()[0];
+            CHECK(change.index() == BlockIndex{ 0,0,0 });
+            CHECK(change.newStressRatio().maxCoord() == 0.f);
+        }
+
+        SECTION("// stress epsilon") {
+            ChangeRecord coarseChanges{ 1000.f * u.one };
+            t.clear();
+            t.removeBlock({ 0,2,0 });
+            WorldUpdater{ world }.runTransaction(t, coarseChanges);
+            CHECK(coarseChanges.removedBlocks() == std::vector<BlockIndex>{ {0,2,0} });
+            CHECK(coarseChanges.stressChanges().empty());
+        }
+    }
+
+    SECTION(".solvePending(ChangeRecord&)") {
+        world.solveMode = WorldData::SolveMode::Lazy;
+        WorldUpdater::Transaction t;
+        t.addBlock({ {0,0,0}, concrete_20m, blockMass, true });
+        t.addBlock({ {0,1,0}, concrete_20m, blockMass, false });
+        t.addBlock({ {0,2,0}, concrete_20m, blockMass, false });
+        auto const trRes1 = WorldUpdater{ world }.runTransaction(t);
+        auto const structure1 = world.scene.structures().at(trRes1.newStructures().at(0));
+        CHECK(structure1.userData().isPending());
+        CHECK(world.pendingStructures == std::unordered_set{ structure1.index() });
+        CHECK(world.scene.blocks().at({ 0,1,0 }).userData().stressRatio().maxCoord() == 0.f);
+
+        SECTION("// replaced before being solved") {
+            t.clear();
+            t.removeBlock({ 0,2,0 });
+            auto const trRes2 = WorldUpdater{ world }.runTransaction(t);
+            CHECK(world.pendingStructures == std::unordered_set{ trRes2.newStructures().at(0) });
+
+            ChangeRecord changes{ 0.f * u.one };
+            WorldUpdater{ world }.solvePending(changes);
+            CHECK(world.pendingStructures.empty());
+            CHECK(changes.stressChanges().size() == 2);
+            checkForce({ 0,0,0 }, { 0,1,0 }, blockMass * g);
+        }
+
+        SECTION("// solved on first read") {
+            CHECK(structure1.userData().state() == StructureState::Solved);
+            CHECK_FALSE(structure1.userData().isPending());
+            CHECK(world.pendingStructures.empty());
+            checkForce({ 0,0,0 }, { 0,1,0 }, 2.f * blockMass * g);
+            auto const& blockData = world.scene.blocks().at({ 0,1,0 }).userData();
+            CHECK(blockData.stressRatio() == BlockReference{ world, {0,1,0} }.stressRatio());
+        }
+    }
+
+    SECTION(".solvePending(std::chrono::nanoseconds)") {
+        world.solveMode = WorldData::SolveMode::Lazy;
+        WorldUpdater::Transaction t;
+        for (int x = 0; x < 6; x += 2) {
+            t.addBlock({ {x,0,0}, concrete_20m, blockMass, true });
+            t.addBlock({ {x,1,0}, concrete_20m, blockMass, false });
+        }
+        WorldUpdater{ world }.runTransaction(t);
+        REQUIRE(world.pendingStructures.size() == 3);
+        auto userDataOf = [&](BlockIndex const& index) -> auto& {
+            return world.scene.structures().at(sceneStructureOf(index).index()).userData();
+        };
+        userDataOf({ 0,1,0 }).setPriority(1.f * u.one);
+        userDataOf({ 2,1,0 }).setPriority(3.f * u.one);
+        userDataOf({ 4,1,0 }).setPriority(2.f * u.one);
+
+        WorldUpdater{ world }.solvePending(std::chrono::nanoseconds{ 0 });
+        CHECK(world.pendingStructures.size() == 2);
+        CHECK_FALSE(userDataOf({ 2,1,0 }).isPending());
+        CHECK(userDataOf({ 4,1,0 }).isPending());
+
+        ChangeRecord changes{ 0.f * u.one };
+        WorldUpdater{ world }.solvePending(std::chrono::hours{ 1 }, changes);
+        CHECK(world.pendingStructures.empty());
+        CHECK(changes.stressChanges().size() == 4);
+        checkForce({ 0,0,0 }, { 0,1,0 }, blockMass * g);
+    }
 }
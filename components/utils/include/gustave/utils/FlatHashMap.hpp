@@ -0,0 +1,311 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <gustave/meta/Meta.hpp>
+#include <gustave/utils/ForwardIterator.hpp>
+#include <gustave/utils/Prop.hpp>
+
+namespace gustave::utils {
+    // Open-addressing hash map (linear probing, power-of-two capacity).
+    //
+    // Elements are stored inline: insert() & erase() invalidate all iterators & references.
+    // Hash_ should mix its output into the low bits (used to select the first probed slot).
+    template<typename Key_, typename Mapped_, typename Hash_ = std::hash<Key_>, typename KeyEqual_ = std::equal_to<Key_>>
+    class FlatHashMap {
+    public:
+        using Key = Key_;
+        using Mapped = Mapped_;
+        using Value = std::pair<Key const, Mapped>;
+    private:
+        using Slot = std::optional<Value>;
+
+        template<bool isMut_>
+        class Enumerator {
+        private:
+            using SlotPtr = Prop<isMut_, Slot>*;
+        public:
+            [[nodiscard]]
+            Enumerator()
+                : slot_{ nullptr }
+                , end_{ nullptr }
+            {}
+
+            [[nodiscard]]
+            explicit Enumerator(SlotPtr slot, SlotPtr end)
+                : slot_{ slot }
+                , end_{ end }
+            {
+                skipEmptySlots();
+            }
+
+            [[nodiscard]]
+            bool isEnd() const {
+                return slot_ == end_;
+            }
+
+            void operator++() {
+                ++slot_;
+                skipEmptySlots();
+            }
+
+            [[nodiscard]]
+            Prop<isMut_, Value>& operator*() const {
+                return **slot_;
+            }
+
+            [[nodiscard]]
+            bool operator==(Enumerator const&) const = default;
+        private:
+            void skipEmptySlots() {
+                while (slot_ != end_ && !slot_->has_value()) {
+                    ++slot_;
+                }
+            }
+
+            SlotPtr slot_;
+            SlotPtr end_;
+        };
+    public:
+        using Iterator = ForwardIterator<Enumerator<true>>;
+        using ConstIterator = ForwardIterator<Enumerator<false>>;
+
+        [[nodiscard]]
+        static constexpr std::size_t minCapacity() {
+            return 8;
+        }
+
+        [[nodiscard]]
+        FlatHashMap()
+            : size_{ 0 }
+        {}
+
+        [[nodiscard]]
+        FlatHashMap(FlatHashMap const&) = default;
+
+        [[nodiscard]]
+        FlatHashMap(FlatHashMap&&) = default;
+
+        FlatHashMap& operator=(FlatHashMap const& other) {
+            if (this != &other) {
+                *this = FlatHashMap{ other };
+            }
+            return *this;
+        }
+
+        FlatHashMap& operator=(FlatHashMap&&) = default;
+
+        [[nodiscard]]
+        Mapped& at(Key const& key) {
+            return doAt(*this, key);
+        }
+
+        [[nodiscard]]
+        Mapped const& at(Key const& key) const {
+            return doAt(*this, key);
+        }
+
+        [[nodiscard]]
+        Iterator begin() {
+            return iteratorAt(*this, 0);
+        }
+
+        [[nodiscard]]
+        ConstIterator begin() const {
+            return iteratorAt(*this, 0);
+        }
+
+        // Number of slots.
+        [[nodiscard]]
+        std::size_t capacity() const {
+            return slots_.size();
+        }
+
+        void clear() {
+            slots_.clear();
+            size_ = 0;
+        }
+
+        [[nodiscard]]
+        bool contains(Key const& key) const {
+            return slotIdOf(key) != slots_.size();
+        }
+
+        [[nodiscard]]
+        Iterator end() {
+            return iteratorAt(*this, slots_.size());
+        }
+
+        [[nodiscard]]
+        ConstIterator end() const {
+            return iteratorAt(*this, slots_.size());
+        }
+
+        bool erase(Key const& key) {
+            std::size_t holeId = slotIdOf(key);
+            if (holeId == slots_.size()) {
+                return false;
+            }
+            // Backward shift deletion: no tombstones.
+            std::size_t const mask = slots_.size() - 1;
+            slots_[holeId].reset();
+            for (std::size_t curId = (holeId + 1) & mask; slots_[curId].has_value(); curId = (curId + 1) & mask) {
+                std::size_t const homeId = homeSlotIdOf(slots_[curId]->first);
+                if (((curId - homeId) & mask) >= ((curId - holeId) & mask)) {
+                    slots_[holeId].emplace(std::move(*slots_[curId]));
+                    slots_[curId].reset();
+                    holeId = curId;
+                }
+            }
+            --size_;
+            return true;
+        }
+
+        [[nodiscard]]
+        Iterator find(Key const& key) {
+            return iteratorAt(*this, slotIdOf(key));
+        }
+
+        [[nodiscard]]
+        ConstIterator find(Key const& key) const {
+            return iteratorAt(*this, slotIdOf(key));
+        }
+
+        std::pair<Iterator, bool> insert(Value const& value) {
+            return tryEmplace(value.first, value.second);
+        }
+
+        void reserve(std::size_t count) {
+            std::size_t newCapacity = minCapacity();
+            while (isOverloaded(count, newCapacity)) {
+                newCapacity *= 2;
+            }
+            if (newCapacity > slots_.size()) {
+                rehash(newCapacity);
+            }
+        }
+
+        [[nodiscard]]
+        std::size_t size() const {
+            return size_;
+        }
+
+        template<typename... MappedArgs>
+        std::pair<Iterator, bool> tryEmplace(Key const& key, MappedArgs&&... mappedArgs) {
+            std::size_t const existingId = slotIdOf(key);
+            if (existingId != slots_.size()) {
+                return { iteratorAt(*this, existingId), false };
+            }
+            if (isOverloaded(size_ + 1, slots_.size())) {
+                rehash(slots_.empty() ? minCapacity() : 2 * slots_.size());
+            }
+            std::size_t const mask = slots_.size() - 1;
+            std::size_t slotId = homeSlotIdOf(key);
+            while (slots_[slotId].has_value()) {
+                slotId = (slotId + 1) & mask;
+            }
+            slots_[slotId].emplace(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<MappedArgs>(mappedArgs)...));
+            ++size_;
+            return { iteratorAt(*this, slotId), true };
+        }
+    private:
+        [[nodiscard]]
+        static bool isOverloaded(std::size_t count, std::size_t capacity) {
+            // Max load factor: 3/4.
+            return 4 * count > 3 * capacity;
+        }
+
+        [[nodiscard]]
+        static auto doAt(meta::cCvRefOf<FlatHashMap> auto&& self, Key const& key) -> decltype(self.at(key)) {
+            std::size_t const slotId = self.slotIdOf(key);
+            if (slotId == self.slots_.size()) {
+                throw std::out_of_range("FlatHashMap: key not found.");
+            }
+            return self.slots_[slotId]->second;
+        }
+
+        [[nodiscard]]
+        static auto iteratorAt(meta::cCvRefOf<FlatHashMap> auto&& self, std::size_t slotId) -> decltype(self.begin()) {
+            auto const slots = self.slots_.data();
+            return decltype(self.begin()){ slots + slotId, slots + self.slots_.size() };
+        }
+
+        [[nodiscard]]
+        std::size_t homeSlotIdOf(Key const& key) const {
+            assert(!slots_.empty());
+            return hash_(key) & (slots_.size() - 1);
+        }
+
+        void rehash(std::size_t newCapacity) {
+            assert((newCapacity & (newCapacity - 1)) == 0);
+            std::vector<Slot> oldSlots(newCapacity);
+            std::swap(oldSlots, slots_);
+            std::size_t const mask = newCapacity - 1;
+            for (Slot& oldSlot : oldSlots) {
+                if (oldSlot.has_value()) {
+                    std::size_t slotId = homeSlotIdOf(oldSlot->first);
+                    while (slots_[slotId].has_value()) {
+                        slotId = (slotId + 1) & mask;
+                    }
+                    slots_[slotId].emplace(std::move(*oldSlot));
+                }
+            }
+        }
+
+        // Returns slots_.size() if the key is not in the map.
+        [[nodiscard]]
+        std::size_t slotIdOf(Key const& key) const {
+            if (slots_.empty()) {
+                return 0;
+            }
+            std::size_t const mask = slots_.size() - 1;
+            std::size_t slotId = homeSlotIdOf(key);
+            while (slots_[slotId].has_value()) {
+                if (keyEqual_(slots_[slotId]->first, key)) {
+                    return slotId;
+                }
+                slotId = (slotId + 1) & mask;
+            }
+            return slots_.size();
+        }
+
+        std::vector<Slot> slots_;
+        std::size_t size_;
+        [[no_unique_address]]
+        Hash_ hash_;
+        [[no_unique_address]]
+        KeyEqual_ keyEqual_;
+    };
+}
@@ -25,12 +25,15 @@
 
 #pragma once
 
+#include <cassert>
 #include <concepts>
+#include <cstddef>
 #include <memory>
-#include <unordered_map>
+#include <vector>
 
 #include <gustave/meta/Meta.hpp>
 #include <gustave/utils/cHashable.hpp>
+#include <gustave/utils/FlatHashMap.hpp>
 #include <gustave/utils/ForwardIterator.hpp>
 #include <gustave/utils/Prop.hpp>
 
@@ -43,8 +46,12 @@ namespace gustave::utils {
         { meta::value(cv.index()) } -> cHashIndex;
     };
 
+    // Map of shared values, indexed by Value::index().
+    //
+    // Values are stored contiguously: iteration is linear in memory. erase() & extract() move the last value
+    // into the freed position, so they invalidate iterators (but not the values).
     template<cIndexedItem Value_>
-    class SharedIndexedSet {
+    class SharedSlotMap {
     public:
         using Index = decltype(meta::value(std::declval<Value_ const&>().index()));
         using Value = Value_;
@@ -52,105 +59,100 @@ namespace gustave::utils {
         template<typename T>
         using SharedPtr = prop::SharedPtr<T>;
     private:
-        using Map = std::unordered_map<Index, SharedPtr<Value>>;
+        using Values = std::vector<SharedPtr<Value>>;
 
         template<bool isMut_>
         class Enumerator {
         private:
-            using MapIterator = utils::PropIterator<isMut_, Map>;
+            using ValuesIterator = utils::PropIterator<isMut_, Values>;
         public:
-            using MapMember = utils::Prop<isMut_, Map>;
+            using ValuesMember = utils::Prop<isMut_, Values>;
             using ItValue = std::conditional_t<isMut_, std::shared_ptr<Value>, SharedPtr<Value>>;
             using Reference = ItValue const&;
 
             [[nodiscard]]
             Enumerator()
-                : map_{ nullptr }
-                , mapIt_{}
+                : values_{ nullptr }
+                , valuesIt_{}
             {}
 
             [[nodiscard]]
-            explicit Enumerator(MapMember& structures)
-                : map_{ &structures }
-                , mapIt_{ structures.begin() }
+            explicit Enumerator(ValuesMember& values)
+                : values_{ &values }
+                , valuesIt_{ values.begin() }
             {}
 
             [[nodiscard]]
             bool isEnd() const {
-                return mapIt_ == map_->end();
+                return valuesIt_ == values_->end();
             }
 
             void operator++() {
-                ++mapIt_;
+                ++valuesIt_;
             }
 
             [[nodiscard]]
             Reference operator*() const {
                 if constexpr (isMut_) {
-                    return mapIt_->second.unprop();
-                }
-                else {
-                    return mapIt_->second;
+                    return valuesIt_->unprop();
+                } else {
+                    return *valuesIt_;
                 }
             }
 
             [[nodiscard]]
             bool operator==(Enumerator const& other) const {
-                return mapIt_ == other.mapIt_;
+                return valuesIt_ == other.valuesIt_;
             }
         private:
-            MapMember* map_;
-            MapIterator mapIt_;
+            ValuesMember* values_;
+            ValuesIterator valuesIt_;
         };
     public:
         using Iterator = ForwardIterator<Enumerator<true>>;
         using ConstIterator = ForwardIterator<Enumerator<false>>;
 
         [[nodiscard]]
-        SharedIndexedSet() = default;
-
-        [[nodiscard]]
-        SharedIndexedSet(SharedIndexedSet&&) = default;
+        SharedSlotMap() = default;
 
         [[nodiscard]]
-        SharedIndexedSet(SharedIndexedSet&) = default;
+        SharedSlotMap(SharedSlotMap&&) = default;
 
-        SharedIndexedSet& operator=(SharedIndexedSet&&) = default;
-        SharedIndexedSet& operator=(SharedIndexedSet&) = default;
+        SharedSlotMap& operator=(SharedSlotMap&&) = default;
 
         [[nodiscard]]
         Value& at(Index const& id) {
-            return *map_.at(id);
+            return *values_[positionOf(id)];
         }
 
         [[nodiscard]]
         Value const& at(Index const& id) const {
-            return *map_.at(id);
+            return *values_[positionOf(id)];
         }
 
         [[nodiscard]]
         SharedPtr<Value> atShared(Index const& id) {
-            return map_.at(id);
+            return values_[positionOf(id)];
         }
 
         [[nodiscard]]
         std::shared_ptr<Value const> atShared(Index const& id) const {
-            return map_.at(id);
+            return values_[positionOf(id)];
         }
 
         [[nodiscard]]
         Iterator begin() {
-            return Iterator{ map_ };
+            return Iterator{ values_ };
         }
 
         [[nodiscard]]
         ConstIterator begin() const {
-            return ConstIterator{ map_ };
+            return ConstIterator{ values_ };
         }
 
         [[nodiscard]]
         bool contains(Index const& id) const {
-            return map_.contains(id);
+            return positions_.contains(id);
         }
 
         [[nodiscard]]
@@ -165,18 +167,24 @@ namespace gustave::utils {
             return insert(std::make_shared<Value>(std::forward<ValueCtorArgs>(valueCtorArgs)...));
         }
 
-
         bool erase(Index const& id) {
-            auto const numDeleted = map_.erase(id);
-            return numDeleted > 0;
+            return extract(id) != nullptr;
         }
 
         SharedPtr<Value> extract(Index const& id) {
-            if (auto node = map_.extract(id)) {
-                return std::move(node.mapped());
-            } else {
+            auto const it = positions_.find(id);
+            if (it == positions_.end()) {
                 return nullptr;
             }
+            std::size_t const position = (*it).second;
+            positions_.erase(id);
+            SharedPtr<Value> result = std::move(values_[position]);
+            if (position + 1 != values_.size()) {
+                values_[position] = std::move(values_.back());
+                positions_.at(values_[position]->index()) = position;
+            }
+            values_.pop_back();
+            return result;
         }
 
         [[nodiscard]]
@@ -202,36 +210,43 @@ namespace gustave::utils {
         Value& insert(SharedPtr<Value> newValue) {
             assert(newValue);
             [[maybe_unused]]
-            auto const res = map_.insert({ newValue->index(), std::move(newValue) });
+            auto const res = positions_.insert({ newValue->index(), values_.size() });
             assert(res.second);
-            return *res.first->second;
+            values_.push_back(std::move(newValue));
+            return *values_.back();
         }
 
         [[nodiscard]]
         std::size_t size() const {
-            return map_.size();
+            return values_.size();
         }
     private:
         [[nodiscard]]
-        static auto doFind(meta::cCvRefOf<SharedIndexedSet> auto&& self, Index const& id) -> decltype(self.find(id)) {
-            auto const it = self.map_.find(id);
-            if (it != self.map_.end()) {
-                return it->second.get();
+        static auto doFind(meta::cCvRefOf<SharedSlotMap> auto&& self, Index const& id) -> decltype(self.find(id)) {
+            auto const it = self.positions_.find(id);
+            if (it != self.positions_.end()) {
+                return self.values_[(*it).second].get();
             } else {
                 return nullptr;
             }
         }
 
         [[nodiscard]]
-        static auto doFindShared(meta::cCvRefOf<SharedIndexedSet> auto&& self, Index const& id) -> decltype(self.findShared(id)) {
-            auto const it = self.map_.find(id);
-            if (it != self.map_.end()) {
-                return it->second;
+        static auto doFindShared(meta::cCvRefOf<SharedSlotMap> auto&& self, Index const& id) -> decltype(self.findShared(id)) {
+            auto const it = self.positions_.find(id);
+            if (it != self.positions_.end()) {
+                return self.values_[(*it).second];
             } else {
                 return nullptr;
             }
         }
 
-        Map map_;
+        [[nodiscard]]
+        std::size_t positionOf(Index const& id) const {
+            return positions_.at(id);
+        }
+
+        Values values_;
+        FlatHashMap<Index, std::size_t> positions_;
     };
 }
@@ -0,0 +1,186 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace gustave::utils {
+    // Fixed set of worker threads, implementing utils::cExecutor.
+    //
+    // The thread calling parallelFor() takes part in the loop, and idle workers help it. Nested calls (from a
+    // worker, or from inside the loop) never wait for a free worker, and never start extra threads.
+    class ThreadPool {
+    private:
+        using Task = std::function<void()>;
+
+        struct LoopState {
+            [[nodiscard]]
+            explicit LoopState(std::size_t count_)
+                : count{ count_ }
+                , nextIndex{ 0 }
+                , doneCount{ 0 }
+            {}
+
+            std::size_t const count;
+            std::atomic<std::size_t> nextIndex;
+            std::atomic<std::size_t> doneCount;
+            std::mutex errorMutex;
+            std::exception_ptr error;
+        };
+    public:
+        [[nodiscard]]
+        explicit ThreadPool(std::size_t threadCount = defaultThreadCount())
+            : isStopping_{ false }
+        {
+            threads_.reserve(threadCount);
+            for (std::size_t threadId = 0; threadId < threadCount; ++threadId) {
+                threads_.emplace_back([this]() { runWorker(); });
+            }
+        }
+
+        ThreadPool(ThreadPool const&) = delete;
+        ThreadPool& operator=(ThreadPool const&) = delete;
+
+        // Waits for every submitted task to be run, including the ones submitted by the tasks themselves.
+        ~ThreadPool() {
+            {
+                std::lock_guard lock{ mutex_ };
+                isStopping_ = true;
+            }
+            wakeUp_.notify_all();
+            for (auto& thread : threads_) {
+                thread.join();
+            }
+            while (!tasks_.empty()) {
+                Task task = std::move(tasks_.front());
+                tasks_.pop_front();
+                task();
+            }
+        }
+
+        // One worker per hardware thread, minus the thread submitting the work.
+        [[nodiscard]]
+        static std::size_t defaultThreadCount() {
+            unsigned const hwThreads = std::thread::hardware_concurrency();
+            return (hwThreads > 1) ? std::size_t(hwThreads - 1) : 0;
+        }
+
+        // Rethrows the first exception thrown by func (once all the calls that started are done).
+        void parallelFor(std::size_t count, auto&& func) {
+            if (count == 0) {
+                return;
+            }
+            std::size_t const helperCount = std::min(threads_.size(), count - 1);
+            if (helperCount == 0) {
+                for (std::size_t index = 0; index < count; ++index) {
+                    func(index);
+                }
+                return;
+            }
+            auto const state = std::make_shared<LoopState>(count);
+            auto const runLoop = [state, &func]() {
+                for (std::size_t index = state->nextIndex++; index < state->count; index = state->nextIndex++) {
+                    try {
+                        func(index);
+                    } catch (...) {
+                        std::lock_guard lock{ state->errorMutex };
+                        if (!state->error) {
+                            state->error = std::current_exception();
+                        }
+                    }
+                    if (++state->doneCount == state->count) {
+                        state->doneCount.notify_all();
+                    }
+                }
+            };
+            {
+                std::lock_guard lock{ mutex_ };
+                for (std::size_t helperId = 0; helperId < helperCount; ++helperId) {
+                    tasks_.emplace_back(runLoop);
+                }
+            }
+            wakeUp_.notify_all();
+            runLoop();
+            for (std::size_t done = state->doneCount; done < count; done = state->doneCount) {
+                state->doneCount.wait(done);
+            }
+            if (state->error) {
+                std::rethrow_exception(state->error);
+            }
+        }
+
+        // Runs task asynchronously on a worker, or immediately if the pool has no worker. The task must not throw.
+        void submit(auto&& task) {
+            if (threads_.empty()) {
+                task();
+                return;
+            }
+            {
+                std::lock_guard lock{ mutex_ };
+                tasks_.emplace_back(std::forward<decltype(task)>(task));
+            }
+            wakeUp_.notify_one();
+        }
+
+        [[nodiscard]]
+        std::size_t threadCount() const {
+            return threads_.size();
+        }
+    private:
+        void runWorker() {
+            while (true) {
+                Task task;
+                {
+                    std::unique_lock lock{ mutex_ };
+                    wakeUp_.wait(lock, [this]() { return isStopping_ || !tasks_.empty(); });
+                    if (tasks_.empty()) {
+                        return;
+                    }
+                    task = std::move(tasks_.front());
+                    tasks_.pop_front();
+                }
+                task();
+            }
+        }
+
+        std::mutex mutex_;
+        std::condition_variable wakeUp_;
+        std::deque<Task> tasks_;
+        std::vector<std::thread> threads_;
+        bool isStopping_;
+    };
+}
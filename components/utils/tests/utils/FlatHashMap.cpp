@@ -0,0 +1,196 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <gustave/utils/FlatHashMap.hpp>
+
+namespace utils = gustave::utils;
+
+namespace {
+    // Sends every key into 4 home slots: forces long probe sequences.
+    struct CollidingHash {
+        [[nodiscard]]
+        std::size_t operator()(int key) const {
+            return static_cast<std::size_t>(key) % 4;
+        }
+    };
+}
+
+using Map = utils::FlatHashMap<int, std::string>;
+using CollidingMap = utils::FlatHashMap<int, int, CollidingHash>;
+
+static_assert(std::forward_iterator<Map::Iterator>);
+static_assert(std::forward_iterator<Map::ConstIterator>);
+
+TEST_CASE("utils::FlatHashMap") {
+    auto map = Map{};
+    auto const& cMap = map;
+    map.insert({ 5, "five" });
+    map.insert({ -3, "minus three" });
+
+    SECTION(".at()") {
+        SECTION("// valid") {
+            CHECK(map.at(5) == "five");
+            CHECK(cMap.at(-3) == "minus three");
+        }
+
+        SECTION("// invalid") {
+            CHECK_THROWS_AS(map.at(4), std::out_of_range);
+            CHECK_THROWS_AS(cMap.at(3), std::out_of_range);
+        }
+    }
+
+    SECTION(".begin() // & .end()") {
+        std::unordered_map<int, std::string> values;
+        for (auto const& [key, value] : cMap) {
+            values[key] = value;
+        }
+        CHECK(values == std::unordered_map<int, std::string>{ { 5, "five" }, { -3, "minus three" } });
+        CHECK(std::distance(map.begin(), map.end()) == 2);
+    }
+
+    SECTION(".clear()") {
+        map.clear();
+        CHECK(map.size() == 0);
+        CHECK(map.begin() == map.end());
+        CHECK_FALSE(map.contains(5));
+    }
+
+    SECTION(".contains()") {
+        CHECK(cMap.contains(5));
+        CHECK_FALSE(cMap.contains(6));
+        CHECK_FALSE(Map{}.contains(6));
+    }
+
+    SECTION(".erase()") {
+        CHECK(map.erase(5));
+        CHECK_FALSE(map.erase(5));
+        CHECK(map.size() == 1);
+        CHECK_FALSE(map.contains(5));
+        CHECK(map.at(-3) == "minus three");
+    }
+
+    SECTION(".find()") {
+        SECTION("// valid") {
+            auto it = map.find(5);
+            REQUIRE(it != map.end());
+            CHECK(it->first == 5);
+            it->second = "FIVE";
+            CHECK(cMap.find(5)->second == "FIVE");
+        }
+
+        SECTION("// invalid") {
+            CHECK(map.find(7) == map.end());
+            CHECK(cMap.find(7) == cMap.end());
+        }
+    }
+
+    SECTION(".insert()") {
+        SECTION("// new key") {
+            auto const [it, inserted] = map.insert({ 7, "seven" });
+            CHECK(inserted);
+            CHECK(it->second == "seven");
+            CHECK(map.size() == 3);
+        }
+
+        SECTION("// existing key") {
+            auto const [it, inserted] = map.insert({ 5, "other" });
+            CHECK_FALSE(inserted);
+            CHECK(it->second == "five");
+            CHECK(map.size() == 2);
+        }
+
+        SECTION("// growth") {
+            for (int key = 100; key < 1100; ++key) {
+                map.insert({ key, std::to_string(key) });
+            }
+            CHECK(map.size() == 1002);
+            CHECK(4 * map.size() <= 3 * map.capacity());
+            for (int key = 100; key < 1100; ++key) {
+                REQUIRE(cMap.at(key) == std::to_string(key));
+            }
+        }
+    }
+
+    SECTION(".operator=(FlatHashMap const&)") {
+        auto copy = Map{};
+        copy.insert({ 1, "one" });
+        copy = cMap;
+        CHECK(copy.size() == 2);
+        CHECK(copy.at(5) == "five");
+        CHECK_FALSE(copy.contains(1));
+    }
+
+    SECTION(".reserve()") {
+        map.reserve(100);
+        auto const capacity = map.capacity();
+        CHECK(4 * 100 <= 3 * capacity);
+        for (int key = 0; key < 98; ++key) {
+            map.insert({ key + 10, "" });
+        }
+        CHECK(map.capacity() == capacity);
+        CHECK(map.at(5) == "five");
+    }
+
+    SECTION(".tryEmplace()") {
+        auto const [it, inserted] = map.tryEmplace(8, 3, 'x');
+        CHECK(inserted);
+        CHECK(it->second == "xxx");
+        CHECK_FALSE(map.tryEmplace(8, "y").second);
+    }
+
+    SECTION("// colliding hash: random operations") {
+        auto cMap2 = CollidingMap{};
+        std::unordered_map<int, int> expected;
+        std::mt19937 rng{ 42 };
+        std::uniform_int_distribution<int> keyDist{ 0, 63 };
+        for (int step = 0; step < 2000; ++step) {
+            int const key = keyDist(rng);
+            if (step % 3 == 0) {
+                REQUIRE(cMap2.erase(key) == (expected.erase(key) == 1));
+            } else {
+                REQUIRE(cMap2.insert({ key, step }).second == expected.insert({ key, step }).second);
+            }
+            REQUIRE(cMap2.size() == expected.size());
+        }
+        for (int key = 0; key < 64; ++key) {
+            auto const it = expected.find(key);
+            if (it == expected.end()) {
+                CHECK_FALSE(cMap2.contains(key));
+            } else {
+                CHECK(cMap2.at(key) == it->second);
+            }
+        }
+    }
+}
@@ -0,0 +1,57 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <gustave/utils/cExecutor.hpp>
+#include <gustave/utils/SerialExecutor.hpp>
+
+namespace utils = gustave::utils;
+
+using SerialExecutor = utils::SerialExecutor;
+
+static_assert(utils::cExecutor<SerialExecutor>);
+
+TEST_CASE("utils::SerialExecutor") {
+    auto executor = SerialExecutor{};
+
+    SECTION(".parallelFor(std::size_t, auto&&)") {
+        std::vector<std::size_t> calls;
+        auto const recordCall = [&calls](std::size_t index) { calls.push_back(index); };
+
+        SECTION("// empty") {
+            executor.parallelFor(0, recordCall);
+            CHECK(calls.empty());
+        }
+
+        SECTION("// non-empty") {
+            executor.parallelFor(4, recordCall);
+            CHECK(calls == std::vector<std::size_t>{ 0, 1, 2, 3 });
+        }
+    }
+}
@@ -28,7 +28,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_range_equals.hpp>
 
-#include <gustave/utils/SharedIndexedSet.hpp>
+#include <gustave/utils/SharedSlotMap.hpp>
 #include <gustave/testing/ConstDetector.hpp>
 
 #include <Point.hpp>
@@ -55,14 +55,14 @@ namespace {
     };
 }
 
-using Set = utils::SharedIndexedSet<Item>;
+using Set = utils::SharedSlotMap<Item>;
 
 template<typename T>
 using SharedPtr = Set::SharedPtr<T>;
 
 static_assert(std::ranges::forward_range<Set>);
 
-TEST_CASE("utils::SharedIndexedSet") {
+TEST_CASE("utils::SharedSlotMap") {
     auto set = Set{};
     auto const& cSet = set;
     auto& i012 = set.emplace(Point{ 0,1,2 }, 12);
@@ -216,4 +216,19 @@ TEST_CASE("utils::SharedIndexedSet") {
     SECTION(".size()") {
         CHECK(cSet.size() == 2);
     }
+
+    SECTION("// erase moves the last value") {
+        auto& i777 = set.emplace(Point{ 7,7,7 }, 777);
+        set.erase({ 0,1,2 });
+        CHECK(cSet.size() == 2);
+        CHECK(&cSet.at(Point{ 5,0,5 }) == &i505);
+        CHECK(&cSet.at(Point{ 7,7,7 }) == &i777);
+        CHECK_FALSE(cSet.contains(Point{ 0,1,2 }));
+
+        auto& i333 = set.emplace(Point{ 3,3,3 }, 333);
+        CHECK(&cSet.at(Point{ 3,3,3 }) == &i333);
+        CHECK(&cSet.at(Point{ 7,7,7 }) == &i777);
+        auto const expected = std::array{ set.atShared({5,0,5}), set.atShared({7,7,7}), set.atShared({3,3,3}) };
+        CHECK_THAT(cSet, Catch::Matchers::UnorderedRangeEquals(expected));
+    }
 }
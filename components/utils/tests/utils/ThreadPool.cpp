@@ -0,0 +1,127 @@
+/* This file is part of Gustave, a structural integrity library for video games.
+ *
+ * Copyright (c) 2022-2026 Vincent Saulue-Laborde <vincent_saulue@hotmail.fr>
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <latch>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <gustave/utils/cExecutor.hpp>
+#include <gustave/utils/ThreadPool.hpp>
+
+namespace utils = gustave::utils;
+
+using ThreadPool = utils::ThreadPool;
+
+static_assert(utils::cExecutor<ThreadPool>);
+
+TEST_CASE("utils::ThreadPool") {
+    auto pool = ThreadPool{ 3 };
+
+    SECTION(".parallelFor(std::size_t, auto&&)") {
+        std::vector<std::atomic<int>> calls(100);
+        auto const recordCall = [&calls](std::size_t index) { ++calls[index]; };
+
+        SECTION("// empty") {
+            pool.parallelFor(0, recordCall);
+        }
+
+        SECTION("// non-empty") {
+            pool.parallelFor(calls.size(), recordCall);
+            for (auto const& callCount : calls) {
+                CHECK(callCount == 1);
+            }
+        }
+
+        SECTION("// nested") {
+            pool.parallelFor(10, [&](std::size_t outer) {
+                pool.parallelFor(10, [&](std::size_t inner) {
+                    recordCall(10 * outer + inner);
+                });
+            });
+            for (auto const& callCount : calls) {
+                CHECK(callCount == 1);
+            }
+        }
+
+        SECTION("// exception") {
+            auto const throwingCall = [](std::size_t index) {
+                if (index == 5) {
+                    throw std::runtime_error("error");
+                }
+            };
+            CHECK_THROWS_AS(pool.parallelFor(10, throwingCall), std::runtime_error);
+        }
+
+        SECTION("// no worker") {
+            auto serialPool = ThreadPool{ 0 };
+            serialPool.parallelFor(calls.size(), recordCall);
+            for (auto const& callCount : calls) {
+                CHECK(callCount == 1);
+            }
+        }
+    }
+
+    SECTION(".submit(auto&&)") {
+        std::atomic<int> runCount = 0;
+        std::latch done{ 4 };
+        for (int taskId = 0; taskId < 4; ++taskId) {
+            pool.submit([&]() {
+                ++runCount;
+                done.count_down();
+            });
+        }
+        done.wait();
+        CHECK(runCount == 4);
+
+        SECTION("// no worker") {
+            auto serialPool = ThreadPool{ 0 };
+            bool isRun = false;
+            serialPool.submit([&isRun]() { isRun = true; });
+            CHECK(isRun);
+        }
+
+        SECTION("// destruction") {
+            std::atomic<int> lateCount = 0;
+            {
+                auto localPool = ThreadPool{ 2 };
+                for (int taskId = 0; taskId < 20; ++taskId) {
+                    localPool.submit([&]() {
+                        ++lateCount;
+                        localPool.submit([&lateCount]() { ++lateCount; });
+                    });
+                }
+            }
+            CHECK(lateCount == 40);
+        }
+    }
+
+    SECTION(".threadCount()") {
+        CHECK(pool.threadCount() == 3);
+    }
+}
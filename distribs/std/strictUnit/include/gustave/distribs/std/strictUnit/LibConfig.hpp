@@ -26,6 +26,7 @@
 #pragma once
 
 #include <concepts>
+#include <cstddef>
 
 #include <gustave/math3d/NormalizedVector3.hpp>
 #include <gustave/math3d/Vector3.hpp>
@@ -33,7 +34,7 @@
 #include <gustave/units/stdStrict/RealTraits.hpp>
 
 namespace gustave::distribs::std::strictUnit {
-    template<::std::floating_point RealRep_>
+    template<::std::floating_point RealRep_, ::std::unsigned_integral Index_ = ::std::size_t>
     struct LibConfig {
         static constexpr units::stdStrict::RealTraits realTraits{};
 
@@ -44,8 +45,11 @@ namespace gustave::distribs::std::strictUnit {
 
         using NormalizedVector3 = ::gustave::math3d::NormalizedVector3<realTraits, RealRep_>;
 
-        using LinkIndex = ::std::size_t;
-        using NodeIndex = ::std::size_t;
-        using StructureIndex = ::std::size_t;
+        using LinkIndex = Index_;
+        using NodeIndex = Index_;
+        using StructureIndex = Index_;
+
+        template<::std::floating_point OtherRealRep>
+        using WithRealRep = LibConfig<OtherRealRep, Index_>;
     };
 }
@@ -25,10 +25,16 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include <gustave/distribs/std/unitless/LibConfig.hpp>
 #include <gustave/core/Gustave.hpp>
 
 namespace gustave::distribs::std::unitless {
     template<::std::floating_point RealRep_>
     using Gustave = gustave::core::Gustave<LibConfig<RealRep_>{}>;
+
+    // 32-bit node/link/structure indices: halves the size of index arrays in solver structures.
+    template<::std::floating_point RealRep_>
+    using CompactGustave = gustave::core::Gustave<LibConfig<RealRep_, ::std::uint32_t>{}>;
 }